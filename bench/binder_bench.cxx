@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * binder_bench.cpp - Benchmark loading a 50k-key config with binder against a std::unordered_map of setters
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof_binder.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace bench {
+enum class Level { trace, debug, info, warning, error };
+
+struct Config {
+    std::string_view listen_address;
+    unsigned short listen_port;
+    int worker_threads;
+    int max_connections;
+    long long connection_timeout_ms;
+    long long idle_timeout_ms;
+    double retry_backoff_factor;
+    int retry_limit;
+    bool tls_enabled;
+    bool compression_enabled;
+    Level log_level;
+    std::string_view log_path;
+    unsigned queue_depth;
+    unsigned batch_size;
+    double sampling_ratio;
+    bool metrics_enabled;
+};
+}
+
+namespace {
+using namespace bench;
+using Binder = meta::binder<Config, &Config::listen_address, &Config::listen_port, &Config::worker_threads,
+    &Config::max_connections, &Config::connection_timeout_ms, &Config::idle_timeout_ms, &Config::retry_backoff_factor,
+    &Config::retry_limit, &Config::tls_enabled, &Config::compression_enabled, &Config::log_level, &Config::log_path,
+    &Config::queue_depth, &Config::batch_size, &Config::sampling_ratio, &Config::metrics_enabled>;
+
+constexpr std::size_t keys = 50000;
+
+std::string config_file() {
+    constexpr std::string_view values[] = { "0.0.0.0", "8443", "16", "10000", "30000", "600000", "1.5", "5",
+        "true", "false", "warning", "/var/log/worker.log", "4096", "64", "0.01", "1" };
+    std::string result;
+    for(std::size_t i = 0; i < keys; ++i) {
+        const auto index = (i * 7919) % Binder::count();
+        result.append(Binder::keys[index]).append("=").append(values[index]).append("\n");
+    }
+    return result;
+}
+
+/// Calls f(key, value) for each key=value line
+template <typename F>
+void for_each_line(std::string_view text, F&& f) {
+    while(! text.empty()) {
+        const auto eol = std::min(text.find('\n'), text.size());
+        const auto line = text.substr(0, eol);
+        const auto eq = line.find('=');
+        f(line.substr(0, eq), line.substr(eq + 1));
+        text.remove_prefix(std::min(eol + 1, text.size()));
+    }
+}
+
+using setter = std::function<meta::bind_status(Config&, std::string_view)>;
+
+template <auto Member>
+void add_setter(std::unordered_map<std::string, setter>& map, const char* key) {
+    map.emplace(key, [](Config& config, std::string_view value) {
+        return meta::detail::parse_value(config.*Member, value);
+    });
+}
+
+std::unordered_map<std::string, setter> setters() {
+    std::unordered_map<std::string, setter> map;
+    add_setter<&Config::listen_address>(map, "listen_address");
+    add_setter<&Config::listen_port>(map, "listen_port");
+    add_setter<&Config::worker_threads>(map, "worker_threads");
+    add_setter<&Config::max_connections>(map, "max_connections");
+    add_setter<&Config::connection_timeout_ms>(map, "connection_timeout_ms");
+    add_setter<&Config::idle_timeout_ms>(map, "idle_timeout_ms");
+    add_setter<&Config::retry_backoff_factor>(map, "retry_backoff_factor");
+    add_setter<&Config::retry_limit>(map, "retry_limit");
+    add_setter<&Config::tls_enabled>(map, "tls_enabled");
+    add_setter<&Config::compression_enabled>(map, "compression_enabled");
+    add_setter<&Config::log_level>(map, "log_level");
+    add_setter<&Config::log_path>(map, "log_path");
+    add_setter<&Config::queue_depth>(map, "queue_depth");
+    add_setter<&Config::batch_size>(map, "batch_size");
+    add_setter<&Config::sampling_ratio>(map, "sampling_ratio");
+    add_setter<&Config::metrics_enabled>(map, "metrics_enabled");
+    return map;
+}
+
+void BM_UnorderedMapLoad(benchmark::State& state) {
+    const auto text = config_file();
+    const auto map = setters();
+    for(auto _ : state) {
+        Config config {};
+        for_each_line(text, [&](std::string_view key, std::string_view value) {
+            const auto found = map.find(std::string{key});
+            benchmark::DoNotOptimize(found != map.end() ? found->second(config, value) : meta::bind_status::unknown_key);
+        });
+        benchmark::DoNotOptimize(config);
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * keys));
+}
+
+void BM_BinderLoad(benchmark::State& state) {
+    const auto text = config_file();
+    for(auto _ : state) {
+        Config config {};
+        for_each_line(text, [&](std::string_view key, std::string_view value) {
+            benchmark::DoNotOptimize(Binder::bind(config, key, value));
+        });
+        benchmark::DoNotOptimize(config);
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * keys));
+}
+}
+
+BENCHMARK(BM_UnorderedMapLoad);
+BENCHMARK(BM_BinderLoad);
@@ -0,0 +1,115 @@
+#!/bin/bash
+#
+# Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+#
+# compile_bench.sh - compile time and binary size benchmark on synthetic translation units
+#
+# Licensed under MIT License, see full text in LICENSE
+# or visit page https://opensource.org/license/mit/
+#
+# Usage: compile_bench.sh <output.csv>
+# Generates translation units with TYPES types, ENUMS enums of ENUMERATORS enumerators each and
+# NESTED types nested DEPTH levels deep, compiles each with every compiler of COMPILERS found in PATH
+# and appends a CSV row per unit with compile time, peak memory, .rodata size and symbol count.
+# Peak memory is the maximum resident set size if /usr/bin/time is available,
+# otherwise the GCC garbage collected memory reported by -ftime-report, and empty for other compilers.
+
+set -e
+
+OUTPUT=${1:-compile_bench.csv}
+WORKDIR=$(dirname "$OUTPUT")
+INCLUDES=${INCLUDES:-../include}
+FLAGS=${FLAGS:--std=c++17 -O2}
+COMPILERS=${COMPILERS:-g++ clang++}
+TYPES=${TYPES:-1000}
+ENUMS=${ENUMS:-100}
+ENUMERATORS=${ENUMERATORS:-16}
+NESTED=${NESTED:-100}
+DEPTH=${DEPTH:-16}
+
+header() {
+    echo '#include <meta/nameof.h>'
+    echo '#include <cstdio>'
+    echo 'static void put(meta::name_type name) { std::fwrite(name.data(), 1, name.size(), stdout); }'
+}
+
+generate_types() {
+    header
+    for ((i = 0; i < TYPES; i++)); do
+        echo "namespace probe { struct Type$i {}; }"
+    done
+    echo 'int main() {'
+    for ((i = 0; i < TYPES; i++)); do
+        echo "    put(meta::static_fully_qualified_nameof<probe::Type$i>());"
+    done
+    echo '}'
+}
+
+generate_enums() {
+    header
+    for ((i = 0; i < ENUMS; i++)); do
+        echo -n "namespace probe { enum class Enum$i {"
+        for ((j = 0; j < ENUMERATORS; j++)); do
+            echo -n " value$j,"
+        done
+        echo ' }; }'
+    done
+    echo 'int main(int argc, char**) {'
+    for ((i = 0; i < ENUMS; i++)); do
+        echo "    put(meta::enum_name(static_cast<probe::Enum$i>(argc)));"
+    done
+    echo '}'
+}
+
+generate_nested() {
+    local open close
+    for ((j = 0; j < DEPTH; j++)); do
+        open+="Template<"
+        close+=">"
+    done
+    header
+    echo 'namespace probe { template <typename T> struct Template {}; template <unsigned N> struct Leaf {}; }'
+    echo 'int main() {'
+    echo '    using namespace probe;'
+    for ((i = 0; i < NESTED; i++)); do
+        echo "    put(meta::static_fully_qualified_nameof<${open}Leaf<$i>${close}>());"
+    done
+    echo '}'
+}
+
+# prints wall clock seconds and peak memory in kB of compiling $2 with $1 into $3
+measure() {
+    local compiler=$1 source=$2 object=$3 report=$object.report start finish memory=
+    start=$(date +%s.%N)
+    if [ -x /usr/bin/time ]; then
+        /usr/bin/time -f %M -o "$report" $compiler $FLAGS -I"$INCLUDES" -c "$source" -o "$object"
+        memory=$(tail -1 "$report")
+    elif $compiler -v 2>&1 | grep -q '^gcc version'; then
+        $compiler $FLAGS -I"$INCLUDES" -ftime-report -c "$source" -o "$object" 2> "$report"
+        memory=$(awk '/^ TOTAL/ { m = $NF; u = substr(m, length(m)); m = m + 0;
+            if (u == "M") m *= 1024; else if (u == "G") m *= 1048576; print int(m) }' "$report")
+    else
+        $compiler $FLAGS -I"$INCLUDES" -c "$source" -o "$object"
+    fi
+    finish=$(date +%s.%N)
+    echo "$(awk "BEGIN { printf \"%.3f\", $finish - $start }") $memory"
+}
+
+echo "compiler,unit,types,enumerators,depth,compile_s,memory_kb,rodata_bytes,symbols" > "$OUTPUT"
+for unit in types enums nested; do
+    source=$WORKDIR/compile_bench_$unit.cxx
+    generate_$unit > "$source"
+    case $unit in
+        types)  shape="$TYPES,0,0" ;;
+        enums)  shape="$ENUMS,$ENUMERATORS,0" ;;
+        nested) shape="$NESTED,0,$DEPTH" ;;
+    esac
+    for compiler in $COMPILERS; do
+        command -v "$compiler" > /dev/null || continue
+        object=$WORKDIR/compile_bench_${unit}_$compiler.o
+        read -r seconds memory <<< "$(measure "$compiler" "$source" "$object")"
+        rodata=$(size -A "$object" | awk '/^\.rodata/ { s += $2 } END { print s + 0 }')
+        symbols=$(nm "$object" | wc -l)
+        echo "$compiler,$unit,$shape,$seconds,$memory,$rodata,$symbols" | tee -a "$OUTPUT"
+    done
+done
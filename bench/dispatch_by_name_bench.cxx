@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * dispatch_by_name_bench.cpp - Benchmark dispatch_by_name against a chain of name comparisons
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof.h>
+#include <string>
+#include <vector>
+
+namespace bench {
+template <int N>
+struct message {
+    static constexpr int id = N;
+};
+}
+
+namespace {
+using namespace bench;
+
+template <int ... N>
+meta::type_list<message<N>...> make_messages(std::integer_sequence<int, N...>);
+
+template <int Count>
+using messages = decltype(make_messages(std::make_integer_sequence<int, Count>{}));
+
+struct handler {
+    template <typename T>
+    int operator()() const { return T::id; }
+};
+
+template <typename ... Ts>
+std::vector<std::string> make_inputs(meta::type_list<Ts...>) {
+    const std::vector<std::string> names { std::string{meta::static_fully_qualified_nameof<Ts>()}... };
+    std::vector<std::string> result;
+    for(std::size_t i = 0; i < 1024; ++i)
+        result.push_back(names[(i * 7919) % names.size()]);
+    return result;
+}
+
+template <typename ... Ts, typename F>
+int linear_dispatch(meta::type_list<Ts...>, std::string_view name, F&& f) {
+    int result = -1;
+    ((name == meta::static_fully_qualified_nameof<Ts>() ? (result = f.template operator()<Ts>(), true) : false) || ...);
+    return result;
+}
+
+template <int Count>
+void BM_LinearChain(benchmark::State& state) {
+    const auto inputs = make_inputs(messages<Count>{});
+    for(auto _ : state) {
+        for(const auto& name : inputs)
+            benchmark::DoNotOptimize(linear_dispatch(messages<Count>{}, name, handler{}));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * inputs.size()));
+}
+
+template <int Count>
+void BM_DispatchByName(benchmark::State& state) {
+    const auto inputs = make_inputs(messages<Count>{});
+    for(auto _ : state) {
+        for(const auto& name : inputs)
+            benchmark::DoNotOptimize(meta::dispatch_by_name<messages<Count>>(name, handler{}));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * inputs.size()));
+}
+}
+
+BENCHMARK_TEMPLATE(BM_LinearChain, 10);
+BENCHMARK_TEMPLATE(BM_LinearChain, 100);
+BENCHMARK_TEMPLATE(BM_LinearChain, 1000);
+BENCHMARK_TEMPLATE(BM_DispatchByName, 10);
+BENCHMARK_TEMPLATE(BM_DispatchByName, 100);
+BENCHMARK_TEMPLATE(BM_DispatchByName, 1000);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * dynamic_nameof_bench.cpp - Benchmark dynamic_nameof against typeid().name() with __cxa_demangle
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof_dynamic.h>
+#include <cxxabi.h>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace bench {
+struct Message {
+    virtual ~Message() = default;
+};
+struct Order : Message {};
+struct Cancel : Message {};
+struct Replace : Message {};
+struct Execution : Message {};
+template <typename T>
+struct Envelope : Message {};
+}
+
+NAMEOF_REGISTER_DYNAMIC(bench::Order);
+NAMEOF_REGISTER_DYNAMIC(bench::Cancel);
+NAMEOF_REGISTER_DYNAMIC(bench::Replace);
+NAMEOF_REGISTER_DYNAMIC(bench::Execution);
+NAMEOF_REGISTER_DYNAMIC(bench::Envelope<bench::Order>);
+
+namespace {
+using namespace bench;
+
+std::vector<std::unique_ptr<Message>> messages() {
+    std::vector<std::unique_ptr<Message>> result;
+    for(int i = 0; i < 64; ++i) {
+        switch(i % 5) {
+        case 0: result.emplace_back(std::make_unique<Order>()); break;
+        case 1: result.emplace_back(std::make_unique<Cancel>()); break;
+        case 2: result.emplace_back(std::make_unique<Replace>()); break;
+        case 3: result.emplace_back(std::make_unique<Execution>()); break;
+        default: result.emplace_back(std::make_unique<Envelope<Order>>()); break;
+        }
+    }
+    return result;
+}
+
+void BM_Demangle(benchmark::State& state) {
+    const auto objects = messages();
+    for(auto _ : state) {
+        for(const auto& object : objects) {
+            int status = 0;
+            char* name = abi::__cxa_demangle(typeid(*object).name(), nullptr, nullptr, &status);
+            benchmark::DoNotOptimize(name);
+            std::free(name);
+        }
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * objects.size()));
+}
+
+void BM_DynamicNameof(benchmark::State& state) {
+    const auto objects = messages();
+    for(auto _ : state) {
+        for(const auto& object : objects)
+            benchmark::DoNotOptimize(meta::dynamic_nameof(*object));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * objects.size()));
+}
+}
+
+BENCHMARK(BM_Demangle)->Threads(1)->Threads(16);
+BENCHMARK(BM_DynamicNameof)->Threads(1)->Threads(16);
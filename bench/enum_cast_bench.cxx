@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * enum_cast_bench.cpp - Benchmark enum_cast against a linear scan and std::unordered_map
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+enum class Venue {
+    XNYS, XNAS, ARCX, BATS, BATY, EDGA, EDGX, IEXG, MEMX, XASE,
+    XBOS, XCHI, XCIS, XPHL, EPRL, LTSE, XLON, XPAR, XETR, XAMS,
+};
+
+std::vector<std::string> inputs() {
+    std::vector<std::string> result;
+    const auto& values = meta::enum_values<Venue>();
+    for(std::size_t i = 0; i < 1024; ++i)
+        result.emplace_back(meta::enum_name(values[(i * 7919) % values.size()]));
+    return result;
+}
+
+std::optional<Venue> linear_cast(std::string_view name) {
+    for(const auto value : meta::enum_values<Venue>())
+        if (meta::enum_name(value) == name)
+            return value;
+    return std::nullopt;
+}
+
+void BM_LinearScan(benchmark::State& state) {
+    const auto names = inputs();
+    for(auto _ : state) {
+        for(const auto& name : names)
+            benchmark::DoNotOptimize(linear_cast(name));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * names.size()));
+}
+
+void BM_UnorderedMap(benchmark::State& state) {
+    const auto names = inputs();
+    std::unordered_map<std::string, Venue> map;
+    for(const auto value : meta::enum_values<Venue>())
+        map.emplace(meta::enum_name(value), value);
+    for(auto _ : state) {
+        for(const auto& name : names)
+            benchmark::DoNotOptimize(map.find(name));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * names.size()));
+}
+
+void BM_EnumCast(benchmark::State& state) {
+    const auto names = inputs();
+    for(auto _ : state) {
+        for(const auto& name : names)
+            benchmark::DoNotOptimize(meta::enum_cast<Venue>(name));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * names.size()));
+}
+
+void BM_EnumCastIgnoreCase(benchmark::State& state) {
+    const auto names = inputs();
+    for(auto _ : state) {
+        for(const auto& name : names)
+            benchmark::DoNotOptimize(meta::enum_cast<Venue, meta::enum_cast_flags::ignore_case>(name));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * names.size()));
+}
+}
+
+BENCHMARK(BM_LinearScan);
+BENCHMARK(BM_UnorderedMap);
+BENCHMARK(BM_EnumCast);
+BENCHMARK(BM_EnumCastIgnoreCase);
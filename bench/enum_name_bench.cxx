@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * enum_name_bench.cpp - Benchmark enum_name against a hand-written switch
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof.h>
+#include <vector>
+
+namespace {
+enum class Color { red, orange, yellow, green, cyan, blue, indigo, violet };
+enum class Code : short { ok = 0, moved = 30, bad = 40, denied = 43, missing = 44, failed = 50, busy = 53 };
+
+std::string_view switch_name(Color value) {
+    switch(value) {
+    case Color::red:    return "red";
+    case Color::orange: return "orange";
+    case Color::yellow: return "yellow";
+    case Color::green:  return "green";
+    case Color::cyan:   return "cyan";
+    case Color::blue:   return "blue";
+    case Color::indigo: return "indigo";
+    case Color::violet: return "violet";
+    default:            return {};
+    }
+}
+
+std::string_view switch_name(Code value) {
+    switch(value) {
+    case Code::ok:      return "ok";
+    case Code::moved:   return "moved";
+    case Code::bad:     return "bad";
+    case Code::denied:  return "denied";
+    case Code::missing: return "missing";
+    case Code::failed:  return "failed";
+    case Code::busy:    return "busy";
+    default:            return {};
+    }
+}
+
+template <typename E>
+std::vector<E> inputs() {
+    std::vector<E> result;
+    const auto& values = meta::enum_values<E>();
+    for(std::size_t i = 0; i < 1024; ++i)
+        result.push_back(values[(i * 7919) % values.size()]);
+    return result;
+}
+
+template <typename E>
+void BM_Switch(benchmark::State& state) {
+    const auto values = inputs<E>();
+    for(auto _ : state) {
+        for(const auto value : values)
+            benchmark::DoNotOptimize(switch_name(value));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * values.size()));
+}
+
+template <typename E>
+void BM_EnumName(benchmark::State& state) {
+    const auto values = inputs<E>();
+    for(auto _ : state) {
+        for(const auto value : values)
+            benchmark::DoNotOptimize(meta::enum_name(value));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * values.size()));
+}
+}
+
+BENCHMARK_TEMPLATE(BM_Switch, Color);
+BENCHMARK_TEMPLATE(BM_EnumName, Color);
+BENCHMARK_TEMPLATE(BM_Switch, Code);
+BENCHMARK_TEMPLATE(BM_EnumName, Code);
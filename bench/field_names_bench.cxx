@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * field_names_bench.cpp - Benchmark serializing with for_each_field against a hand-written serializer
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof_fields.h>
+#include <charconv>
+#include <cstring>
+
+#if __cpp_nontype_template_args >= 201911L
+namespace {
+struct Quote {
+    long id;
+    int venue;
+    int side;
+    long bid_price;
+    long ask_price;
+    int bid_size;
+    int ask_size;
+    long last_price;
+    int last_size;
+    long volume;
+    long open;
+    long high;
+    long low;
+    long close;
+    int trades;
+    int flags;
+    long timestamp;
+    long sequence;
+    int session;
+    int condition;
+};
+
+class writer {
+public:
+    explicit writer(char* buffer) : begin_(buffer), pos_(buffer) {}
+    void put(char c) { *pos_++ = c; }
+    void put(std::string_view text) {
+        std::memcpy(pos_, text.data(), text.size());
+        pos_ += text.size();
+    }
+    template <typename Number>
+    void number(Number value) { pos_ = std::to_chars(pos_, pos_ + 24, value).ptr; }
+    std::size_t size() const { return static_cast<std::size_t>(pos_ - begin_); }
+private:
+    char* begin_;
+    char* pos_;
+};
+
+std::size_t hand_written(const Quote& q, char* buffer) {
+    writer out { buffer };
+    out.put("{\"id\":"); out.number(q.id);
+    out.put(",\"venue\":"); out.number(q.venue);
+    out.put(",\"side\":"); out.number(q.side);
+    out.put(",\"bid_price\":"); out.number(q.bid_price);
+    out.put(",\"ask_price\":"); out.number(q.ask_price);
+    out.put(",\"bid_size\":"); out.number(q.bid_size);
+    out.put(",\"ask_size\":"); out.number(q.ask_size);
+    out.put(",\"last_price\":"); out.number(q.last_price);
+    out.put(",\"last_size\":"); out.number(q.last_size);
+    out.put(",\"volume\":"); out.number(q.volume);
+    out.put(",\"open\":"); out.number(q.open);
+    out.put(",\"high\":"); out.number(q.high);
+    out.put(",\"low\":"); out.number(q.low);
+    out.put(",\"close\":"); out.number(q.close);
+    out.put(",\"trades\":"); out.number(q.trades);
+    out.put(",\"flags\":"); out.number(q.flags);
+    out.put(",\"timestamp\":"); out.number(q.timestamp);
+    out.put(",\"sequence\":"); out.number(q.sequence);
+    out.put(",\"session\":"); out.number(q.session);
+    out.put(",\"condition\":"); out.number(q.condition);
+    out.put('}');
+    return out.size();
+}
+
+/// ,"name": prefix of I-th member, built at compile time
+template <typename T, std::size_t I>
+constexpr auto make_json_key() {
+    constexpr auto name = meta::field_names<T>()[I];
+    std::array<char, name.size() + 4> key {};
+    key[0] = I == 0 ? '{' : ',';
+    key[1] = '"';
+    for(std::size_t i = 0; i < name.size(); ++i)
+        key[i + 2] = name[i];
+    key[name.size() + 2] = '"';
+    key[name.size() + 3] = ':';
+    return key;
+}
+
+template <typename T, std::size_t I>
+inline constexpr auto json_key = make_json_key<T, I>();
+
+template <std::size_t ... I>
+std::size_t precomputed(const Quote& q, char* buffer, std::index_sequence<I...>) {
+    writer out { buffer };
+    const auto fields = meta::tie_fields(q);
+    ((out.put({ json_key<Quote, I>.data(), json_key<Quote, I>.size() }), out.number(std::get<I>(fields))), ...);
+    out.put('}');
+    return out.size();
+}
+
+std::size_t reflected(const Quote& q, char* buffer) {
+    writer out { buffer };
+    char separator = '{';
+    meta::for_each_field(q, [&](std::string_view name, auto value) {
+        out.put(separator);
+        out.put('"');
+        out.put(name);
+        out.put("\":");
+        out.number(value);
+        separator = ',';
+    });
+    out.put('}');
+    return out.size();
+}
+
+std::size_t precomputed(const Quote& q, char* buffer) {
+    return precomputed(q, buffer, std::make_index_sequence<meta::field_count<Quote>()>{});
+}
+
+Quote quote() {
+    return { 1, 2, 1, 10050, 10075, 300, 500, 10060, 100, 123456, 10000, 10100, 9900, 10060, 420, 0, 1700000000000, 987654, 1, 0 };
+}
+
+void BM_HandWritten(benchmark::State& state) {
+    const auto q = quote();
+    char buffer[1024];
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(hand_written(q, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_ForEachField(benchmark::State& state) {
+    const auto q = quote();
+    char buffer[1024];
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(reflected(q, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+
+void BM_PrecomputedKeys(benchmark::State& state) {
+    const auto q = quote();
+    char buffer[1024];
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(precomputed(q, buffer));
+        benchmark::ClobberMemory();
+    }
+}
+}
+
+BENCHMARK(BM_HandWritten);
+BENCHMARK(BM_ForEachField);
+BENCHMARK(BM_PrecomputedKeys);
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * name_id_bench.cpp - Benchmark binary log records carrying name ids against records carrying names
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof_intern.h>
+#include <cstring>
+#include <vector>
+
+namespace bench {
+struct NewOrderSingle {};
+struct OrderCancelRequest {};
+enum class Side { buy, sell, sell_short, sell_short_exempt };
+}
+
+namespace {
+using namespace bench;
+using Dictionary = meta::name_dictionary<NewOrderSingle, OrderCancelRequest, Side>;
+
+class log_buffer {
+public:
+    log_buffer() : data_(1 << 20) {}
+    template <typename T>
+    void put(const T& value) {
+        std::memcpy(data_.data() + pos_, &value, sizeof(value));
+        pos_ += sizeof(value);
+    }
+    void put(meta::name_type name) {
+        put(static_cast<std::uint16_t>(name.size()));
+        std::memcpy(data_.data() + pos_, name.data(), name.size());
+        pos_ += name.size();
+    }
+    void rewind() { pos_ = 0; }
+    std::size_t size() const { return pos_; }
+private:
+    std::vector<char> data_;
+    std::size_t pos_ = 0;
+};
+
+constexpr std::size_t records = 1024;
+
+Side side(std::size_t i) { return static_cast<Side>(i % 4); }
+
+void report(benchmark::State& state, std::size_t bytes) {
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * records));
+    state.counters["bytes_per_record"] = static_cast<double>(bytes) / records;
+}
+
+void BM_LogNames(benchmark::State& state) {
+    log_buffer log;
+    for(auto _ : state) {
+        log.rewind();
+        for(std::size_t i = 0; i < records; ++i) {
+            log.put(static_cast<std::uint64_t>(i));
+            log.put(i % 8 ? meta::canonical_nameof<NewOrderSingle>() : meta::canonical_nameof<OrderCancelRequest>());
+            log.put(meta::enum_fully_qualified_name(side(i)));
+            log.put(static_cast<std::uint32_t>(i * 100));
+        }
+        benchmark::ClobberMemory();
+    }
+    report(state, log.size());
+}
+
+void BM_LogNameIds(benchmark::State& state) {
+    log_buffer log;
+    for(auto _ : state) {
+        log.rewind();
+        log.put(meta::name_type{ Dictionary::image.data(), Dictionary::image.size() });
+        for(std::size_t i = 0; i < records; ++i) {
+            log.put(static_cast<std::uint64_t>(i));
+            log.put(i % 8 ? meta::name_id_of<NewOrderSingle>() : meta::name_id_of<OrderCancelRequest>());
+            log.put(meta::enum_name_id(side(i)));
+            log.put(static_cast<std::uint32_t>(i * 100));
+        }
+        benchmark::ClobberMemory();
+    }
+    report(state, log.size());
+}
+}
+
+BENCHMARK(BM_LogNames);
+BENCHMARK(BM_LogNameIds);
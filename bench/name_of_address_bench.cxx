@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * name_of_address_bench.cpp - Benchmark name_of_address against dladdr
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#include <meta/nameof_functions.h>
+#include <dlfcn.h>
+#include <vector>
+
+namespace bench {
+template <int N>
+int callback(int value) { return value * N + N; }
+}
+
+#define NAMEOF_REGISTER_CALLBACKS(N) \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 0>);  NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 1>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 2>);  NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 3>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 4>);  NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 5>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 6>);  NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 7>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 8>);  NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 9>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 10>); NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 11>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 12>); NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 13>); \
+    NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 14>); NAMEOF_REGISTER_FUNCTION(&bench::callback<N + 15>)
+
+NAMEOF_REGISTER_CALLBACKS(0);
+NAMEOF_REGISTER_CALLBACKS(16);
+NAMEOF_REGISTER_CALLBACKS(32);
+NAMEOF_REGISTER_CALLBACKS(48);
+NAMEOF_REGISTER_CALLBACKS(64);
+NAMEOF_REGISTER_CALLBACKS(80);
+NAMEOF_REGISTER_CALLBACKS(96);
+NAMEOF_REGISTER_CALLBACKS(112);
+
+namespace {
+template <int ... N>
+std::vector<const void*> make_addresses(std::integer_sequence<int, N...>) {
+    return { meta::detail::function_address<&bench::callback<N>>()... };
+}
+
+std::vector<const void*> addresses() {
+    const auto callbacks = make_addresses(std::make_integer_sequence<int, 128>{});
+    std::vector<const void*> result;
+    for(std::size_t i = 0; i < 1024; ++i)
+        result.push_back(callbacks[(i * 7919) % callbacks.size()]);
+    return result;
+}
+
+void BM_Dladdr(benchmark::State& state) {
+    const auto inputs = addresses();
+    for(auto _ : state) {
+        for(const auto address : inputs) {
+            Dl_info info {};
+            benchmark::DoNotOptimize(dladdr(address, &info));
+            benchmark::DoNotOptimize(info.dli_sname);
+        }
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * inputs.size()));
+}
+
+void BM_NameOfAddress(benchmark::State& state) {
+    const auto inputs = addresses();
+    for(auto _ : state) {
+        for(const auto address : inputs)
+            benchmark::DoNotOptimize(meta::name_of_address(address));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * inputs.size()));
+}
+
+void BM_NameOfCodeAddress(benchmark::State& state) {
+    meta::load_function_sizes();
+    const auto inputs = addresses();
+    for(auto _ : state) {
+        for(const auto address : inputs)
+            benchmark::DoNotOptimize(meta::name_of_code_address(static_cast<const char*>(address) + 4));
+    }
+    state.SetItemsProcessed(static_cast<long>(state.iterations() * inputs.size()));
+}
+}
+
+BENCHMARK(BM_Dladdr);
+BENCHMARK(BM_NameOfAddress);
+BENCHMARK(BM_NameOfCodeAddress);
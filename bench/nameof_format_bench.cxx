@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_format_bench.cpp - Benchmark enum formatter against formatting through std::string
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <benchmark/benchmark.h>
+#if __has_include(<fmt/format.h>)
+#define FMT_HEADER_ONLY
+#include <fmt/format.h>
+#endif
+#include <meta/nameof_format.h>
+#include <string>
+
+#if defined(FMT_VERSION)
+namespace {
+enum class Event { connected, disconnected, subscribed, rejected, filled, cancelled, expired };
+}
+
+template <>
+struct meta::enable_enum_format<Event> {
+    static constexpr bool value = true;
+};
+
+namespace {
+Event event(std::size_t i) {
+    return static_cast<Event>(i % 7);
+}
+
+void BM_FormatViaString(benchmark::State& state) {
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for(auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "event={} seq={}", std::string(meta::enum_name(event(i))), i);
+        benchmark::DoNotOptimize(buffer.data());
+        ++i;
+    }
+}
+
+void BM_FormatToString(benchmark::State& state) {
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for(auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "event={} seq={}", std::to_string(static_cast<int>(event(i))), i);
+        benchmark::DoNotOptimize(buffer.data());
+        ++i;
+    }
+}
+
+void BM_FormatQualifiedViaString(benchmark::State& state) {
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for(auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "event={} seq={}", std::string(meta::enum_fully_qualified_name(event(i))), i);
+        benchmark::DoNotOptimize(buffer.data());
+        ++i;
+    }
+}
+
+void BM_FormatQualifiedEnum(benchmark::State& state) {
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for(auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "event={:q} seq={}", event(i), i);
+        benchmark::DoNotOptimize(buffer.data());
+        ++i;
+    }
+}
+
+void BM_FormatEnum(benchmark::State& state) {
+    fmt::memory_buffer buffer;
+    std::size_t i = 0;
+    for(auto _ : state) {
+        buffer.clear();
+        fmt::format_to(std::back_inserter(buffer), "event={} seq={}", event(i), i);
+        benchmark::DoNotOptimize(buffer.data());
+        ++i;
+    }
+}
+}
+
+BENCHMARK(BM_FormatViaString);
+BENCHMARK(BM_FormatToString);
+BENCHMARK(BM_FormatEnum);
+BENCHMARK(BM_FormatQualifiedViaString);
+BENCHMARK(BM_FormatQualifiedEnum);
+#endif
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * size_names_of.cpp - compile time and binary size probe for names_of vs static_fully_qualified_nameof
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ *
+ * Build with -DNAMEOF_BATCH_NAMES=1 to take names from names_of,
+ * otherwise names are taken from static_fully_qualified_nameof of each type
+ */
+
+#include <meta/nameof.h>
+#include <cstdio>
+#include <utility>
+
+#ifndef NAMEOF_PROBE_COUNT
+#define NAMEOF_PROBE_COUNT 1000
+#endif
+
+namespace probe {
+template <unsigned N>
+struct Type {};
+
+template <unsigned ... I>
+void print(std::integer_sequence<unsigned, I...>) {
+#if NAMEOF_BATCH_NAMES
+    const meta::name_type* names = meta::names_of<Type<I>...>().data();
+#else
+    const meta::name_type names[] = { meta::static_fully_qualified_nameof<Type<I>>()... };
+#endif
+    for(std::size_t i = 0; i < sizeof...(I); ++i)
+        std::fwrite(names[i].data(), 1, names[i].size(), stdout);
+}
+}
+
+int main() {
+    probe::print(std::make_integer_sequence<unsigned, NAMEOF_PROBE_COUNT>{});
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * size_static_name.cpp - binary size probe for nameof vs static_nameof
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ *
+ * Build with -DNAMEOF_STATIC_NAMES=1 to take names from static_nameof,
+ * otherwise names are taken from nameof
+ */
+
+#include <meta/nameof.h>
+#include <cstdio>
+#include <utility>
+
+#ifndef NAMEOF_PROBE_COUNT
+#define NAMEOF_PROBE_COUNT 1000
+#endif
+
+namespace probe {
+template <unsigned N>
+struct Type {};
+
+template <typename T>
+constexpr meta::name_type name() {
+#if NAMEOF_STATIC_NAMES
+    return meta::static_fully_qualified_nameof<T>();
+#else
+    return meta::fully_qualified_nameof<T>();
+#endif
+}
+
+template <unsigned ... I>
+void print(std::integer_sequence<unsigned, I...>) {
+    const meta::name_type names[] = { name<Type<I>>()... };
+    for(const auto n : names)
+        std::fwrite(n.data(), 1, n.size(), stdout);
+}
+}
+
+int main() {
+    probe::print(std::make_integer_sequence<unsigned, NAMEOF_PROBE_COUNT>{});
+}
@@ -10,6 +10,12 @@
 #pragma once
 #include <string_view>
 #include <algorithm> //std::min
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 /*
  * nameof<> templates using __PRETTY_FUNCTION__/__FUNCSIG__ to infer the template parameter name
@@ -21,6 +27,13 @@
  *   MSVC 19.4
  */
 
+/// Define NAMEOF_CONSTEVAL=1 to make nameof and fully_qualified_nameof consteval, returning fixed_string (C++20)
+#ifndef NAMEOF_CONSTEVAL
+#define NAMEOF_CONSTEVAL 0
+#elif NAMEOF_CONSTEVAL && !(defined(__cpp_consteval) && __cpp_consteval >= 201811L && __cpp_nontype_template_args >= 201911L)
+#error "NAMEOF_CONSTEVAL requires consteval and class type template arguments (C++20)"
+#endif
+
 namespace meta {
 using name_type = std::string_view;
 
@@ -33,17 +46,71 @@ struct view_range { // std::pair is not yet constexpr in msvc
     std::size_t finish;
 };
 
+constexpr bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+constexpr bool is_identifier_start(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+constexpr bool is_identifier_char(char c) {
+    return is_identifier_start(c) || is_digit(c);
+}
+
+/// Returns position past an operator name starting at pos, e.g. operator<<, or pos if there is none there,
+/// only operators spelled with angle brackets are recognized, the longest one wins
+constexpr std::size_t skip_operator_name(name_type name, std::size_t pos) {
+    constexpr name_type keyword = "operator";
+    constexpr name_type symbols[] = { "<=>", "<<=", ">>=", "->*", "<<", ">>", "<=", ">=", "->", "<", ">" };
+    if (name[pos] != 'o' || name.substr(pos, keyword.size()) != keyword || (pos > 0 && is_identifier_char(name[pos - 1])))
+        return pos;
+    const auto end = pos + keyword.size();
+    for(const auto symbol : symbols)
+        if (name.substr(end, symbol.size()) == symbol)
+            return end + symbol.size();
+    return pos;
+}
+
+/// Returns position of the first <...> group at or past start and of its matching bracket,
+/// angle brackets of operator names, such as operator<, and of -> are not counted
 constexpr view_range find_group(name_type name, std::size_t start = 0) {
     unsigned depth = 0;
-    for(auto n = name.find('<', start), i = n; i < name.size(); ++i) {
-        if( name[i] == '<' ) ++depth;
-        else if( name[i] == '>' ) --depth;
-        if (depth == 0)
-            return { n, i };
+    std::size_t open = npos;
+    for(auto i = start; i < name.size(); ++i) {
+        const auto c = name[i];
+        if (c == 'o' && skip_operator_name(name, i) != i) {
+            i = skip_operator_name(name, i) - 1;
+        } else if (c == '<') {
+            if (depth++ == 0)
+                open = i;
+        } else if (c == '>' && depth > 0 && name[i - 1] != '-') {
+            if (--depth == 0)
+                return { open, i };
+        }
     }
     return { npos, npos };
 }
 
+/// Returns position past the last :: outside of template arguments and parentheses, 0 if there is none
+constexpr std::size_t find_last_scope(name_type name) {
+    std::size_t result = 0;
+    unsigned depth = 0;
+    for(std::size_t i = 0; i < name.size(); ++i) {
+        const auto c = name[i];
+        if (c == 'o' && skip_operator_name(name, i) != i) {
+            i = skip_operator_name(name, i) - 1;
+        } else if (c == '<' || c == '(') {
+            ++depth;
+        } else if ((c == ')' || (c == '>' && name[i - 1] != '-')) && depth > 0) {
+            --depth;
+        } else if (c == ':' && depth == 0 && i + 1 < name.size() && name[i + 1] == ':') {
+            result = ++i + 1;
+        }
+    }
+    return result;
+}
+
 constexpr auto parse_funcsig(name_type name) {
     auto group_pos = find_group(name);
     if (group_pos.start == npos)
@@ -101,23 +168,502 @@ constexpr auto parse_pretty_function(name_type name) {
     if (name[0] == '(') name.remove_prefix(1);
     if (name[0] == '&') name.remove_prefix(1);
     if (name[0] == ' ') name.remove_prefix(1);
-    auto semi_pos = name.find(';');
-    auto rbra_pos = name.find(']');
-    auto rcur_pos = name.find(')');
-    auto end_pos = std::min(semi_pos, std::min(rbra_pos, rcur_pos));
-    if(end_pos == npos)
-        return name;
-    return name.substr(0, end_pos);
+    // name ends with ; ] or ) not nested in brackets, e.g. in int (*)(int) or int [3]
+    unsigned depth = 0;
+    for(std::size_t i = 0; i < name.size(); ++i) {
+        const auto c = name[i];
+        if (c == '(' || c == '[') ++depth;
+        else if ((c == ')' || c == ']') && depth != 0) --depth;
+        else if (c == ';' || c == ']' || c == ')') return name.substr(0, i);
+    }
+    return name;
+}
+
+constexpr bool is_funcsig_enumerator(name_type name) {
+    // values which are not enumerators are printed as numbers, e.g. name<0x3>
+    const auto group_pos = find_group(name);
+    if (group_pos.start == npos || group_pos.start + 1 >= name.size())
+        return false;
+    const auto c = name[group_pos.start + 1];
+    return c != '-' && (c < '0' || c > '9');
 }
 
+constexpr bool is_pretty_function_enumerator(name_type name) {
+    // values which are not enumerators are printed as casts, e.g. [with auto V = (Enum)3]
+    const auto eq_pos = name.find('=');
+    if (eq_pos == npos || eq_pos + 2 >= name.size())
+        return false;
+    const auto c = name[eq_pos + 2];
+    return c != '(' && c != '-' && (c < '0' || c > '9');
+}
+
+constexpr std::size_t skip_elaborated_keyword(name_type list, std::size_t pos) {
+    // MSVC prefixes class types in template arguments with struct, class or enum
+    const auto c = list[pos];
+    const name_type key = c == 's' ? "struct " : c == 'c' ? "class " : c == 'e' ? "enum " : "";
+    return !key.empty() && list.substr(pos, key.size()) == key ? pos + key.size() : pos;
+}
+
+/// Wraps types of a pack into a single function type void(pack_item<Ts>*...), compilers spell types in its parameters
+/// as they spell a single template argument, while a pack is spelled with all defaulted template arguments
+template <typename T>
+struct pack_item;
+
+// spelled with or without meta::detail:: depending on the compiler
+inline constexpr name_type pack_item_prefix = "pack_item<";
+
+/// Splits spelling of void(pack_item<Ts>*...) into N ranges of spellings of Ts, ignoring brackets nested in them
+/// Loops make no calls, as constant evaluation of a call hashes its arguments, and with them the whole spelling
+template <std::size_t N>
+constexpr std::array<view_range, N> split_pack(name_type name) {
+    // MSVC prefixes class types with struct or class, parse_funcsig drops them
+    constexpr const char* keywords[] = { "struct ", "class " };
+    std::array<view_range, N> result {};
+    const char* const chars = name.data();
+    const std::size_t size = name.size();
+    std::size_t pos = 0;
+    for(auto& item : result) {
+        for(bool found = false; ! found; ++pos) {
+            if (pos == size)
+                return result;
+            found = chars[pos] == '<' && pos + 1 >= pack_item_prefix.size();
+            for(std::size_t i = 0; found && i < pack_item_prefix.size(); ++i)
+                found = chars[pos + 1 - pack_item_prefix.size() + i] == pack_item_prefix.data()[i];
+        }
+        auto first = pos;
+        for(const auto keyword : keywords) {
+            std::size_t i = 0;
+            while(keyword[i] != '\0' && first + i < size && chars[first + i] == keyword[i])
+                ++i;
+            if (keyword[i] == '\0')
+                first += i;
+        }
+        unsigned depth = 0;
+        for(pos = first; pos < size && (depth != 0 || chars[pos] != '>'); ++pos) {
+            const auto c = chars[pos];
+            if (c == '<' || c == '(' || c == '[' || c == '{') ++depth;
+            else if (c == '>' || c == ')' || c == ']' || c == '}') --depth;
+        }
+        auto last = pos;
+        while(last > first && chars[last - 1] == ' ')
+            --last;
+        item = { first, last };
+    }
+    return result;
+}
+
+/// Returns the last stem of a fully qualified name without its template arguments, e.g. A for ns::A<ns::B>
 constexpr auto parse_fully_qualified_name(name_type name) {
-  const auto col_pos = name.rfind(':');
-  if (col_pos != npos)
-    name.remove_prefix(col_pos + 1);
-  const auto less_pos = name.find('<');
-  if (less_pos != npos)
-      return name.substr(0, less_pos);
-  return name;
+    name.remove_prefix(find_last_scope(name));
+    const auto group = find_group(name);
+    return group.start == npos ? name : name.substr(0, group.start);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+constexpr bool starts_with(name_type name, name_type prefix) {
+    return name.substr(0, prefix.size()) == prefix;
+}
+
+constexpr std::size_t skip_spaces(name_type name, std::size_t pos) {
+    while(pos < name.size() && name[pos] == ' ')
+        ++pos;
+    return pos;
+}
+
+/// Writes canonical name into chars or just counts its size if chars is nullptr
+struct canonical_writer {
+    char* chars;
+    std::size_t size;
+    char last;
+    constexpr void put(char c) {
+        if (chars != nullptr)
+            chars[size] = c;
+        ++size;
+        last = c;
+    }
+    constexpr void put(name_type text) {
+        for(const auto c : text)
+            put(c);
+    }
+};
+
+constexpr bool is_integer_keyword(name_type token) {
+    return token == "unsigned" || token == "signed" || token == "short" || token == "long" || token == "int" ||
+           token == "char" || token == "__int64";
+}
+
+/// Writes a builtin integer type spelled with keywords in any order, e.g. long unsigned int, as unsigned long
+constexpr std::size_t put_integer_type(name_type name, std::size_t pos, canonical_writer& out) {
+    bool is_unsigned = false, is_signed = false, is_short = false, is_char = false;
+    unsigned longs = 0;
+    for(auto i = pos; i < name.size() && is_identifier_start(name[i]); i = skip_spaces(name, pos)) {
+        auto end = i;
+        while(end < name.size() && is_identifier_char(name[end]))
+            ++end;
+        const auto token = name.substr(i, end - i);
+        if (! is_integer_keyword(token))
+            break;
+        is_unsigned = is_unsigned || token == "unsigned";
+        is_signed = is_signed || token == "signed";
+        is_short = is_short || token == "short";
+        is_char = is_char || token == "char";
+        longs += token == "long" ? 1u : token == "__int64" ? 2u : 0u;
+        pos = end;
+    }
+    if (is_unsigned) out.put("unsigned ");
+    else if (is_signed && is_char) out.put("signed ");
+    if (is_char) out.put("char");
+    else if (is_short) out.put("short");
+    else if (longs == 1) out.put("long");
+    else if (longs > 1) out.put("long long");
+    else out.put("int");
+    return pos;
+}
+
+/// Returns position of the < opening the template argument list which contains pos, npos if there is none
+constexpr std::size_t find_group_start(name_type name, std::size_t pos) {
+    unsigned depth = 0;
+    for(auto i = pos; i > 0; --i) {
+        const auto c = name[i - 1];
+        if (c == '>' && !(i > 1 && name[i - 2] == '-')) ++depth;
+        else if (c == '<' && depth == 0) return i - 1;
+        else if (c == '<') --depth;
+    }
+    return npos;
+}
+
+/// Returns n-th template argument in the list opened by < at pos, without surrounding spaces
+constexpr name_type template_argument(name_type name, std::size_t pos, std::size_t n) {
+    unsigned depth = 0;
+    auto start = pos + 1;
+    for(auto i = start; i < name.size(); ++i) {
+        const auto c = name[i];
+        if (c == '<' || c == '(') {
+            ++depth;
+        } else if ((c == '>' && name[i - 1] != '-') || c == ')' || (c == ',' && depth == 0)) {
+            if (depth > 0 && c != ',') {
+                --depth;
+                continue;
+            }
+            if (n-- == 0) {
+                start = skip_spaces(name, start);
+                auto end = i;
+                while(end > start && name[end - 1] == ' ')
+                    --end;
+                return name.substr(start, end - start);
+            }
+            if (c != ',')
+                break;
+            start = i + 1;
+        }
+    }
+    return {};
+}
+
+/// Returns true if lhs and rhs, spelled by the same compiler, name the same type
+constexpr bool same_spelling(name_type lhs, name_type rhs) {
+    std::size_t i = lhs.empty() ? 0 : skip_elaborated_keyword(lhs, 0);
+    std::size_t j = rhs.empty() ? 0 : skip_elaborated_keyword(rhs, 0);
+    for(;; ++i, ++j) {
+        i = skip_spaces(lhs, i);
+        j = skip_spaces(rhs, j);
+        if (i == lhs.size() || j == rhs.size())
+            return i == lhs.size() && j == rhs.size();
+        if (lhs[i] != rhs[j])
+            return false;
+    }
+}
+
+/// Returns true if pair is std::pair<const Key, Value>, the value_type of associative containers
+constexpr bool is_value_type_pair(name_type pair, name_type key, name_type value) {
+    const auto group = find_group(pair);
+    if (group.start == npos || group.finish + 1 != pair.size())
+        return false;
+    const auto head = pair.substr(0, group.start);
+    if (head.size() < sizeof("pair") - 1 || head.substr(head.size() - (sizeof("pair") - 1)) != "pair")
+        return false;
+    auto first = template_argument(pair, group.start, 0);
+    if (starts_with(first, "const "))
+        first.remove_prefix(sizeof("const ") - 1);
+    else if (first.size() > sizeof("const") && first.substr(first.size() - (sizeof(" const") - 1)) == " const")
+        first.remove_suffix(sizeof(" const") - 1);
+    else
+        return false;
+    return same_spelling(first, key) && same_spelling(template_argument(pair, group.start, 1), value);
+}
+
+/*
+ * Returns position past the standard defaulted template argument starting at pos and all arguments following it,
+ * or pos if any of them is not the default, e.g. std::less<K> is the default of std::set<K> while std::less<> is not
+ */
+constexpr std::size_t skip_default_argument(name_type name, std::size_t pos) {
+    enum kind { of_first, of_value_type };
+    constexpr struct { name_type key; kind of; } defaults[] = {
+        { "char_traits<", of_first }, { "allocator<", of_value_type }, { "less<", of_first },
+        { "hash<", of_first }, { "equal_to<", of_first }, { "default_delete<", of_first }
+    };
+    auto i = skip_elaborated_keyword(name, skip_spaces(name, pos));
+    if (! starts_with(name.substr(i), "std::"))
+        return pos;
+    i += sizeof("std::") - 1;
+    for(const name_type inline_ns : { name_type{"__cxx11::"}, name_type{"__1::"} })
+        if (starts_with(name.substr(i), inline_ns))
+            i += inline_ns.size();
+    const auto list = find_group_start(name, pos);
+    if (list == npos)
+        return pos;
+    const auto first = template_argument(name, list, 0);
+    for(const auto& item : defaults) {
+        if (! starts_with(name.substr(i), item.key))
+            continue;
+        const auto group = find_group(name, i);
+        if (group.finish == npos)
+            return pos;
+        const auto argument = template_argument(name, group.start, 0);
+        const bool is_default = same_spelling(argument, first) ||
+            (item.of == of_value_type && is_value_type_pair(argument, first, template_argument(name, list, 1)));
+        const auto next = skip_spaces(name, group.finish + 1);
+        if (! is_default || next >= name.size())
+            return pos;
+        if (name[next] == '>')
+            return group.finish + 1;
+        if (name[next] == ',' && skip_default_argument(name, next + 1) != next + 1)
+            return skip_default_argument(name, next + 1);
+        return pos;
+    }
+    return pos;
+}
+
+/*
+ * Rewrites a name produced by any of the supported compilers into one spelling:
+ * no spaces except between identifiers, no struct/class/enum/union keywords, no std inline namespaces,
+ * integer literals in decimal without suffixes, no standard defaulted template arguments
+ * and (anonymous namespace) for anonymous namespaces
+ */
+constexpr std::size_t canonicalize(name_type name, char* chars) {
+    canonical_writer out { chars, 0, '\0' };
+    bool space = false;
+    for(std::size_t i = 0; i < name.size();) {
+        const auto c = name[i];
+        if (c == ' ') {
+            space = true;
+            ++i;
+        } else if (is_identifier_start(c)) {
+            auto end = i;
+            while(end < name.size() && is_identifier_char(name[end]))
+                ++end;
+            const auto token = name.substr(i, end - i);
+            const auto next = skip_spaces(name, end);
+            i = end;
+            if ((token == "struct" || token == "class" || token == "enum" || token == "union") &&
+                next < name.size() && is_identifier_start(name[next]))
+                continue;
+            if (token == "__cdecl" || token == "__ptr64" || token == "__thiscall" || token == "__stdcall")
+                continue;
+            if ((token == "__cxx11" || token == "__1") && starts_with(name.substr(end), "::")) {
+                i = end + 2;
+                continue;
+            }
+            if (space && is_identifier_char(out.last))
+                out.put(' ');
+            if (is_integer_keyword(token)) {
+                i = put_integer_type(name, i - token.size(), out);
+            } else {
+                out.put(token);
+            }
+            space = false;
+        } else if (is_digit(c)) {
+            unsigned long long value = 0;
+            if (c == '0' && i + 1 < name.size() && (name[i + 1] == 'x' || name[i + 1] == 'X')) {
+                for(i += 2; i < name.size(); ++i) {
+                    const auto d = name[i];
+                    if (is_digit(d)) value = value * 16 + static_cast<unsigned>(d - '0');
+                    else if (d >= 'a' && d <= 'f') value = value * 16 + static_cast<unsigned>(d - 'a' + 10);
+                    else if (d >= 'A' && d <= 'F') value = value * 16 + static_cast<unsigned>(d - 'A' + 10);
+                    else break;
+                }
+            } else {
+                for(; i < name.size() && is_digit(name[i]); ++i)
+                    value = value * 10 + static_cast<unsigned>(name[i] - '0');
+            }
+            while(i < name.size() && (name[i] == 'u' || name[i] == 'U' || name[i] == 'l' || name[i] == 'L'))
+                ++i;
+            if (space && is_identifier_char(out.last))
+                out.put(' ');
+            char digits[20] {};
+            std::size_t count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + value % 10);
+                value /= 10;
+            } while(value != 0);
+            while(count != 0)
+                out.put(digits[--count]);
+            space = false;
+        } else if (starts_with(name.substr(i), "`anonymous namespace'") || starts_with(name.substr(i), "{anonymous}")) {
+            i += name[i] == '`' ? sizeof("`anonymous namespace'") - 1 : sizeof("{anonymous}") - 1;
+            out.put("(anonymous namespace)");
+            space = false;
+        } else if (starts_with(name.substr(i), "(anonymous namespace)")) {
+            i += sizeof("(anonymous namespace)") - 1;
+            out.put("(anonymous namespace)");
+            space = false;
+        } else if (c == ',' && skip_default_argument(name, i + 1) != i + 1) {
+            i = skip_default_argument(name, i + 1);
+        } else {
+            out.put(c);
+            space = false;
+            ++i;
+        }
+    }
+    return out.size;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+inline constexpr std::uint64_t fnv1a_basis = 14695981039346656037ull;
+inline constexpr std::uint64_t fnv1a_prime = 1099511628211ull;
+
+constexpr char to_lower(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+template <bool IgnoreCase = false>
+constexpr std::uint64_t fnv1a(name_type name) {
+    auto hash = fnv1a_basis;
+    for(const auto c : name) {
+        hash ^= static_cast<unsigned char>(IgnoreCase ? to_lower(c) : c);
+        hash *= fnv1a_prime;
+    }
+    return hash;
+}
+
+template <bool IgnoreCase = false>
+constexpr bool equal(name_type lhs, name_type rhs) {
+    if constexpr (IgnoreCase) {
+        if (lhs.size() != rhs.size())
+            return false;
+        for(std::size_t i = 0; i < lhs.size(); ++i)
+            if (to_lower(lhs[i]) != to_lower(rhs[i]))
+                return false;
+        return true;
+    } else {
+        return lhs == rhs;
+    }
+}
+
+constexpr std::uint64_t mix(std::uint64_t hash) { // murmur3 finalizer
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+constexpr std::size_t ceil_pow2(std::size_t value) {
+    std::size_t result = 1;
+    while(result < value)
+        result <<= 1;
+    return result;
+}
+
+/*
+ * Hash-and-displace perfect hash over N keys, built at compile time.
+ * A key hash selects a bucket, the bucket's seed displaces the hash into a slot holding the key index.
+ * Lookup costs one string hash, one integer mix and one key comparison.
+ */
+template <std::size_t N>
+struct perfect_hash {
+    static constexpr std::size_t bucket_count = N == 0 ? 1 : N;
+    static constexpr std::size_t slot_count = ceil_pow2(2 * bucket_count);
+    using index_type = std::conditional_t<(N < std::numeric_limits<std::uint16_t>::max()), std::uint16_t, std::uint32_t>;
+
+    std::array<std::uint32_t, bucket_count> seeds {};
+    std::array<index_type, slot_count> slots {};
+    bool valid = true;
+
+    static constexpr std::size_t bucket(std::uint64_t hash) {
+        return static_cast<std::size_t>((hash >> 32) % bucket_count);
+    }
+    static constexpr std::size_t slot(std::uint64_t hash, std::uint32_t seed) {
+        return static_cast<std::size_t>(mix(hash ^ seed) & (slot_count - 1));
+    }
+    /// Returns index of the only key which may have this hash, N if none
+    constexpr std::size_t lookup(std::uint64_t hash) const {
+        return slots[slot(hash, seeds[bucket(hash)])];
+    }
+};
+
+template <bool IgnoreCase, std::size_t N>
+constexpr perfect_hash<N> make_perfect_hash(const std::array<name_type, N>& keys) {
+    using hash_type = perfect_hash<N>;
+    constexpr auto buckets = hash_type::bucket_count;
+    hash_type result {};
+    std::array<std::uint64_t, N> hashes {};
+    std::array<std::size_t, buckets + 1> offsets {};
+    std::array<std::size_t, N> members {};
+    std::array<std::size_t, buckets> order {};
+    for(auto& slot : result.slots)
+        slot = static_cast<typename hash_type::index_type>(N);
+    for(std::size_t i = 0; i < N; ++i) {
+        hashes[i] = fnv1a<IgnoreCase>(keys[i]);
+        ++offsets[hash_type::bucket(hashes[i]) + 1];
+    }
+    std::size_t largest = 0;
+    for(std::size_t b = 0; b < buckets; ++b) {
+        largest = std::max(largest, offsets[b + 1]);
+        offsets[b + 1] += offsets[b];
+    }
+    auto fill = offsets;
+    for(std::size_t i = 0; i < N; ++i)
+        members[fill[hash_type::bucket(hashes[i])]++] = i;
+    // largest buckets are placed first, while most of the slots are still free, buckets are small, so a sweep
+    // over all buckets per size is linear in N, unlike sorting them
+    std::size_t used = 0;
+    for(auto size = largest; size > 0; --size)
+        for(std::size_t b = 0; b < buckets; ++b)
+            if (offsets[b + 1] - offsets[b] == size)
+                order[used++] = b;
+    for(std::size_t n = 0; n < used; ++n) {
+        const auto b = order[n];
+        const auto first = offsets[b], last = offsets[b + 1];
+        bool placed = true;
+        for(auto i = first; i < last; ++i)
+            for(auto j = i + 1; j < last; ++j)
+                placed = placed && hashes[members[i]] != hashes[members[j]];
+        if (! placed) {
+            result.valid = false; // keys are not unique
+            break;
+        }
+        placed = false;
+        for(std::uint32_t seed = 0; ! placed && seed < (1u << 16); ++seed) {
+            auto i = first;
+            for(; i < last; ++i) {
+                const auto slot = hash_type::slot(hashes[members[i]], seed);
+                if (result.slots[slot] != N)
+                    break;
+                result.slots[slot] = static_cast<typename hash_type::index_type>(members[i]);
+            }
+            placed = i == last;
+            if (placed) {
+                result.seeds[b] = seed;
+            } else {
+                for(auto j = first; j < i; ++j)
+                    result.slots[hash_type::slot(hashes[members[j]], seed)] = static_cast<typename hash_type::index_type>(N);
+            }
+        }
+        if (! placed) {
+            result.valid = false;
+            break;
+        }
+    }
+    return result;
+}
+
+/// Returns index of key in keys or N if it is not there
+template <bool IgnoreCase, std::size_t N>
+constexpr std::size_t find(const perfect_hash<N>& hash, const std::array<name_type, N>& keys, name_type key) {
+    const auto index = hash.lookup(fnv1a<IgnoreCase>(key));
+    return index < N && equal<IgnoreCase>(keys[index], key) ? index : N;
 }
 
 #ifdef _MSC_VER
@@ -132,6 +678,9 @@ constexpr auto name() {
 constexpr auto parse_name(std::string_view name) {
     return parse_funcsig(name);
 }
+constexpr bool is_enumerator_name(std::string_view name) {
+    return is_funcsig_enumerator(name);
+}
 
 #else
 template <typename T>
@@ -145,31 +694,828 @@ constexpr auto name() {
 constexpr auto parse_name(std::string_view name) {
     return parse_pretty_function(name);
 }
+constexpr bool is_enumerator_name(std::string_view name) {
+    return is_pretty_function_enumerator(name);
+}
+#endif
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------------------------
+/// NUL-terminated string of N characters, a structural type usable as a template argument in C++20
+template <std::size_t N>
+struct fixed_string {
+    char chars[N + 1] {};
+
+    constexpr fixed_string() noexcept = default;
+    constexpr fixed_string(const char (&text)[N + 1]) noexcept { // implicit, accepts literals as template arguments
+        for(std::size_t i = 0; i < N; ++i)
+            chars[i] = text[i];
+    }
+
+    constexpr name_type view() const noexcept { return { chars, N }; }
+    constexpr operator name_type() const noexcept { return view(); }
+    constexpr const char* data() const noexcept { return chars; }
+    constexpr const char* c_str() const noexcept { return chars; }
+    static constexpr std::size_t size() noexcept { return N; }
+    static constexpr bool empty() noexcept { return N == 0; }
+    constexpr const char* begin() const noexcept { return chars; }
+    constexpr const char* end() const noexcept { return chars + N; }
+    constexpr char operator[](std::size_t i) const noexcept { return chars[i]; }
+
+    friend constexpr bool operator==(const fixed_string& lhs, name_type rhs) noexcept { return lhs.view() == rhs; }
+    friend constexpr bool operator!=(const fixed_string& lhs, name_type rhs) noexcept { return lhs.view() != rhs; }
+};
+
+template <std::size_t N>
+fixed_string(const char (&)[N]) -> fixed_string<N - 1>;
+
+namespace detail {
+template <std::size_t N>
+using static_name_buffer = fixed_string<N>;
+
+template <std::size_t N>
+constexpr auto make_static_name(name_type name) {
+    static_name_buffer<N> buffer {};
+    for(std::size_t i = 0; i < N; ++i)
+        buffer.chars[i] = name[i];
+    return buffer;
+}
+
+template <typename T, bool Qualified>
+constexpr name_type type_name() {
+    const auto name = parse_name(detail::name<T>());
+    return Qualified ? name : parse_fully_qualified_name(name);
+}
+
+template <auto V, bool Qualified>
+constexpr name_type value_name() {
+    const auto name = parse_name(detail::name<V>());
+    return Qualified ? name : parse_fully_qualified_name(name);
+}
+
+template <typename T, bool Qualified>
+inline constexpr auto static_type_name = make_static_name<type_name<T, Qualified>().size()>(type_name<T, Qualified>());
+
+template <auto V, bool Qualified>
+inline constexpr auto static_value_name = make_static_name<value_name<V, Qualified>().size()>(value_name<V, Qualified>());
+
+template <std::size_t N>
+constexpr auto make_canonical_name(name_type name) {
+    static_name_buffer<N> buffer {};
+    canonicalize(name, buffer.chars);
+    return buffer;
+}
+
+template <typename T>
+inline constexpr auto canonical_type_name =
+    make_canonical_name<canonicalize(type_name<T, true>(), nullptr)>(type_name<T, true>());
+
+template <auto V>
+inline constexpr auto canonical_value_name =
+    make_canonical_name<canonicalize(value_name<V, true>(), nullptr)>(value_name<V, true>());
+
+constexpr std::size_t copy_name(name_type name, char* chars) {
+    canonical_writer out { chars, 0, '\0' };
+    out.put(name);
+    return out.size;
+}
+
+constexpr std::size_t strip_namespace(name_type name, name_type prefix, char* chars) {
+    canonical_writer out { chars, 0, '\0' };
+    for(std::size_t i = 0; i < name.size();) {
+        if (!prefix.empty() && name[i] == prefix[0] && (i == 0 || !(is_identifier_char(name[i - 1]) || name[i - 1] == ':'))
+            && name.substr(i, prefix.size()) == prefix && name.substr(i + prefix.size(), 2) == "::") {
+            i += prefix.size() + 2;
+        } else {
+            out.put(name[i++]);
+        }
+    }
+    return out.size;
+}
+
+/// Returns position past an anonymous namespace qualifier starting at pos, or pos if there is none there
+constexpr std::size_t skip_anonymous_namespace(name_type name, std::size_t pos) {
+    constexpr name_type anonymous[] = { "(anonymous namespace)::", "{anonymous}::", "`anonymous namespace'::" };
+    for(const auto key : anonymous)
+        if (starts_with(name.substr(pos), key))
+            return pos + key.size();
+    return pos;
+}
+
+constexpr std::size_t shorten_template_args(name_type name, char* chars) {
+    canonical_writer out { chars, 0, '\0' };
+    unsigned depth = 0;
+    for(std::size_t i = 0; i < name.size();) {
+        const auto c = name[i];
+        const auto operator_end = skip_operator_name(name, i);
+        const auto anonymous_end = depth > 0 ? skip_anonymous_namespace(name, i) : i;
+        if (operator_end != i) {
+            out.put(name.substr(i, operator_end - i));
+            i = operator_end;
+        } else if (anonymous_end != i) {
+            i = anonymous_end;
+        } else if (depth > 0 && is_identifier_start(c) && !is_identifier_char(out.last)) {
+            auto end = i;
+            while(end < name.size() && is_identifier_char(name[end]))
+                ++end;
+            if (name.substr(end, 2) == "::")
+                end += 2;
+            else
+                out.put(name.substr(i, end - i));
+            i = end;
+        } else {
+            if (c == '<') ++depth;
+            else if (c == '>' && depth > 0 && name[i - 1] != '-') --depth;
+            out.put(c);
+            ++i;
+        }
+    }
+    return out.size;
+}
+
+constexpr std::size_t remove_template_args(name_type name, char* chars) {
+    canonical_writer out { chars, 0, '\0' };
+    for(std::size_t i = 0; i < name.size();) {
+        const auto group = find_group(name, i);
+        const auto last = group.start == npos ? name.size() : group.start;
+        auto end = last;
+        while(end > i && name[end - 1] == ' ')
+            --end;
+        out.put(name.substr(i, end - i));
+        i = group.start == npos ? last : group.finish + 1;
+    }
+    return out.size;
+}
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/*
+ * Name policies transform names for nameof<T, Policies...>(), which applies them in order to the fully qualified name
+ * A policy is a type with a constexpr static member apply(name_type name, char* chars), which writes the transformed
+ * name into chars, or only counts its size if chars is nullptr, and returns the size
+ */
+
+#if __cpp_nontype_template_args >= 201911L
+/// Removes namespace Prefix and the following ::, wherever it starts a qualified name, e.g. strip_ns<"company">
+template <fixed_string Prefix>
+#else
+/// Removes namespace Prefix and the following ::, wherever it starts a qualified name,
+/// Prefix is a NUL-terminated string with static storage, e.g. strip_ns<company> with inline constexpr char company[]
+template <const auto& Prefix>
 #endif
+struct strip_ns {
+    static constexpr std::size_t apply(name_type name, char* chars) {
+        return detail::strip_namespace(name, Prefix, chars);
+    }
+};
+
+/// Removes namespace and class qualifiers from names in template arguments, e.g. ns::A<ns::B> becomes ns::A<B>
+struct short_template_args {
+    static constexpr std::size_t apply(name_type name, char* chars) {
+        return detail::shorten_template_args(name, chars);
+    }
+};
+
+/// Removes all template arguments, e.g. ns::A<ns::B>::C<int> becomes ns::A::C
+struct no_template_args {
+    static constexpr std::size_t apply(name_type name, char* chars) {
+        return detail::remove_template_args(name, chars);
+    }
+};
+
+/// Removes qualifiers of the last stem, keeping its template arguments, e.g. ns::A<ns::B> becomes A<ns::B>
+struct unqualified {
+    static constexpr std::size_t apply(name_type name, char* chars) {
+        return detail::copy_name(name.substr(detail::find_last_scope(name)), chars);
+    }
+};
+
+/// Truncates names longer than N characters
+template <std::size_t N>
+struct max_len {
+    static constexpr std::size_t apply(name_type name, char* chars) {
+        return detail::copy_name(name.substr(0, N), chars);
+    }
+};
+
+namespace detail {
+template <typename T>
+struct type_name_source {
+    static constexpr name_type value = type_name<T, true>();
+};
+
+template <auto V>
+struct value_name_source {
+    static constexpr name_type value = value_name<V, true>();
+};
+
+template <typename Policy, std::size_t N>
+constexpr auto make_transformed_name(name_type name) {
+    static_name_buffer<N> buffer {};
+    Policy::apply(name, buffer.chars);
+    return buffer;
+}
+
+/// Intermediate name, used only in constant expressions and never emitted
+template <typename Source, typename Policy>
+struct policy_stage {
+    static constexpr auto buffer = make_transformed_name<Policy, Policy::apply(Source::value, nullptr)>(Source::value);
+    static constexpr name_type value = buffer.view();
+};
+
+/// Name of Source::value transformed by Policies in order, only the final name is kept in a static buffer
+template <typename Source, typename ... Policies>
+struct transformed_name {
+    static constexpr auto buffer = make_static_name<Source::value.size()>(Source::value);
+};
+
+template <typename Source, typename Policy, typename ... Policies>
+struct transformed_name<Source, Policy, Policies...> : transformed_name<policy_stage<Source, Policy>, Policies...> {};
 } // namespace detail
 //----------------------------------------------------------------------------------------------------------------------
 
+#if NAMEOF_CONSTEVAL
+/*
+ * nameof and fully_qualified_nameof are consteval and return a reference to a static fixed_string,
+ * so names are never parsed at run time and may be used as template arguments
+ */
+
+/// Returns fully qualified name of type T
+template <typename T>
+consteval const auto& fully_qualified_nameof() {
+    return detail::static_type_name<T, true>;
+}
+
+/// Returns fully qualified name of parameter V (if available)
+template <auto V>
+consteval const auto& fully_qualified_nameof() {
+    return detail::static_value_name<V, true>;
+}
+
+/// Returns last stem of the fully qualified name of V
+template <auto V>
+consteval const auto& nameof() {
+    return detail::static_value_name<V, false>;
+}
+
+/// Returns last stem of the fully qualified name of T
+template <typename T>
+consteval const auto& nameof() {
+    return detail::static_type_name<T, false>;
+}
+
+/// Returns fully qualified name of type T transformed by Policies, e.g. nameof<T, strip_ns<"company">, max_len<64>>()
+template <typename T, typename Policy, typename ... Policies>
+consteval const auto& nameof() {
+    return detail::transformed_name<detail::type_name_source<T>, Policy, Policies...>::buffer;
+}
+
+/// Returns fully qualified name of parameter V transformed by Policies
+template <auto V, typename Policy, typename ... Policies>
+consteval const auto& nameof() {
+    return detail::transformed_name<detail::value_name_source<V>, Policy, Policies...>::buffer;
+}
+#else
 /// Returns fully qualified name of type T
 template <typename T>
 constexpr auto fully_qualified_nameof() {
-    return detail::parse_name(detail::name<T>());
+    return detail::type_name<T, true>();
 }
 
 /// Returns fully qualified name of parameter V (if available)
 template <auto V>
 constexpr auto fully_qualified_nameof() {
-    return detail::parse_name(detail::name<V>());
+    return detail::value_name<V, true>();
 }
 
 /// Returns last stem of the fully qualified name of V
 template <auto V>
 constexpr auto nameof() {
-  return detail::parse_fully_qualified_name(fully_qualified_nameof<V>());
+    return detail::value_name<V, false>();
 }
 
 /// Returns last stem of the fully qualified name of T
 template <typename T>
 constexpr auto nameof() {
-    return detail::parse_fully_qualified_name(fully_qualified_nameof<T>());
+    return detail::type_name<T, false>();
+}
+
+/// Returns fully qualified name of type T transformed by Policies, e.g. nameof<T, strip_ns<company>, max_len<64>>(),
+/// stored in a static buffer
+template <typename T, typename Policy, typename ... Policies>
+constexpr name_type nameof() {
+    return detail::transformed_name<detail::type_name_source<T>, Policy, Policies...>::buffer.view();
+}
+
+/// Returns fully qualified name of parameter V transformed by Policies, stored in a static buffer
+template <auto V, typename Policy, typename ... Policies>
+constexpr name_type nameof() {
+    return detail::transformed_name<detail::value_name_source<V>, Policy, Policies...>::buffer.view();
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------------
+
+/*
+ * static_* variants return views into a compile-time NUL-terminated buffer holding only the parsed name,
+ * so the full __PRETTY_FUNCTION__/__FUNCSIG__ literal never reaches the binary
+ */
+
+/// Returns fully qualified name of type T, stored in a static buffer
+template <typename T>
+constexpr name_type static_fully_qualified_nameof() {
+    return detail::static_type_name<T, true>.view();
+}
+
+/// Returns fully qualified name of parameter V, stored in a static buffer
+template <auto V>
+constexpr name_type static_fully_qualified_nameof() {
+    return detail::static_value_name<V, true>.view();
+}
+
+/// Returns last stem of the fully qualified name of T, stored in a static buffer
+template <typename T>
+constexpr name_type static_nameof() {
+    return detail::static_type_name<T, false>.view();
+}
+
+/// Returns last stem of the fully qualified name of V, stored in a static buffer
+template <auto V>
+constexpr name_type static_nameof() {
+    return detail::static_value_name<V, false>.view();
+}
+
+/// Returns fully qualified name of type T, spelled identically by all supported compilers
+template <typename T>
+constexpr name_type canonical_nameof() {
+    return detail::canonical_type_name<T>.view();
+}
+
+/// Returns fully qualified name of parameter V, spelled identically by all supported compilers
+template <auto V>
+constexpr name_type canonical_nameof() {
+    return detail::canonical_value_name<V>.view();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// List of types for type_index_of, unique_type_hashes and alike
+template <typename ... Ts>
+struct type_list {
+    static constexpr std::size_t size = sizeof...(Ts);
+};
+
+namespace detail {
+template <typename T>
+inline constexpr std::uint64_t type_hash_value = fnv1a(canonical_nameof<T>());
+
+template <typename ... Ts>
+constexpr bool unique_type_hashes(type_list<Ts...>) {
+    constexpr std::uint64_t hashes[] = { type_hash_value<Ts>..., 0 };
+    for(std::size_t i = 0; i < sizeof...(Ts); ++i)
+        for(std::size_t j = i + 1; j < sizeof...(Ts); ++j)
+            if (hashes[i] == hashes[j])
+                return false;
+    return true;
+}
+
+template <typename T, typename ... Ts>
+constexpr std::size_t type_index(type_list<Ts...>) {
+    constexpr bool matches[] = { std::is_same_v<T, Ts>..., false };
+    std::size_t index = 0;
+    while(index < sizeof...(Ts) && ! matches[index])
+        ++index;
+    return index;
+}
+
+template <typename T, typename TypeList>
+constexpr std::size_t checked_type_index() {
+    constexpr auto index = type_index<T>(TypeList{});
+    static_assert(index < TypeList::size, "T is not in TypeList");
+    return index;
+}
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns 64-bit FNV-1a hash of the canonical name of T, always computed at compile time
+template <typename T>
+constexpr std::uint64_t type_hash() noexcept {
+    return detail::type_hash_value<T>;
+}
+
+/// Returns true if all types in TypeList have distinct type_hash
+template <typename TypeList>
+constexpr bool unique_type_hashes() {
+    return detail::unique_type_hashes(TypeList{});
+}
+
+/// Position of T in TypeList, a dense index suitable for flat type-indexed arrays
+template <typename T, typename TypeList>
+inline constexpr std::size_t type_index_of = detail::checked_type_index<T, TypeList>();
+
+//----------------------------------------------------------------------------------------------------------------------
+namespace detail {
+/// Names of all types of a pack, parsed from a single instantiation into one contiguous NUL-separated buffer
+template <bool Canonical, typename ... Ts>
+struct pack_names {
+    static constexpr std::size_t count = sizeof...(Ts);
+
+    static constexpr name_type list = name<void(pack_item<Ts>*...)>();
+    static constexpr auto ranges = split_pack<count>(list);
+
+    static constexpr std::array<std::size_t, count> make_sizes() {
+        std::array<std::size_t, count> result {};
+        for(std::size_t i = 0; i < count; ++i) {
+            const auto& range = ranges[i];
+            result[i] = Canonical ? canonicalize(list.substr(range.start, range.finish - range.start), nullptr)
+                                  : range.finish - range.start;
+        }
+        return result;
+    }
+    static constexpr auto sizes = make_sizes();
+
+    static constexpr std::size_t size() {
+        std::size_t result = 0;
+        for(const auto item : sizes)
+            result += item + 1;
+        return result;
+    }
+
+    static constexpr auto make_chars() {
+        std::array<char, size() + 1> result {};
+        char* const out = result.data();
+        const char* const in = list.data();
+        std::size_t pos = 0;
+        for(const auto& range : ranges) {
+            if constexpr (Canonical) {
+                pos += canonicalize(list.substr(range.start, range.finish - range.start), out + pos) + 1;
+            } else {
+                // copied without calls, as constant evaluation of a call hashes its arguments
+                for(auto i = range.start; i < range.finish; ++i)
+                    out[pos++] = in[i];
+                ++pos;
+            }
+        }
+        return result;
+    }
+    static constexpr auto chars = make_chars();
+
+    static constexpr std::array<name_type, count> make_names() {
+        std::array<name_type, count> result {};
+        const char* pos = chars.data();
+        std::size_t i = 0;
+        for(const auto item : sizes) {
+            result[i++] = name_type{ pos, item };
+            pos += item + 1;
+        }
+        return result;
+    }
+    static constexpr auto names = make_names();
+};
+
+template <bool Canonical, typename ... Ts>
+struct pack_names_of { using type = pack_names<Canonical, Ts...>; };
+
+template <bool Canonical, typename ... Ts>
+struct pack_names_of<Canonical, type_list<Ts...>> { using type = pack_names<Canonical, Ts...>; };
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns fully qualified names of Ts... or of types in type_list<Ts...>, same as fully_qualified_nameof<T>() of each
+/// Names are parsed from a single instantiation and stored in one contiguous NUL-separated buffer
+template <typename ... Ts>
+constexpr const auto& names_of() {
+    return detail::pack_names_of<false, Ts...>::type::names;
+}
+
+/// Returns canonical names of Ts... or of types in type_list<Ts...>, same as canonical_nameof<T>() of each
+template <typename ... Ts>
+constexpr const auto& canonical_names_of() {
+    return detail::pack_names_of<true, Ts...>::type::names;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+namespace detail {
+template <typename T, typename R, typename F>
+R dispatch_to(F& f) {
+    return static_cast<R>(f.template operator()<T>());
+}
+
+/// Perfect hash over fully qualified names of Ts, mapping a name to a call of f.template operator()<T>()
+template <typename T0, typename ... Ts>
+struct name_dispatch {
+    static constexpr std::array<name_type, sizeof...(Ts) + 1> keys {{
+        static_fully_qualified_nameof<T0>(), static_fully_qualified_nameof<Ts>()...
+    }};
+    static constexpr auto hash = make_perfect_hash<false>(keys);
+    static_assert(hash.valid, "type names are not unique");
+
+    template <typename F, typename R>
+    static constexpr R (*targets[])(F&) = { &dispatch_to<T0, R, F>, &dispatch_to<Ts, R, F>... };
+
+    template <typename F>
+    static auto call(name_type name, F& f) {
+        using result_type = decltype(f.template operator()<T0>());
+        const auto index = find<false>(hash, keys, name);
+        if constexpr (std::is_void_v<result_type>) {
+            if (index == keys.size())
+                return false;
+            targets<F, void>[index](f);
+            return true;
+        } else {
+            return index == keys.size() ? std::optional<result_type>{}
+                                        : std::optional<result_type>{ targets<F, result_type>[index](f) };
+        }
+    }
+};
+
+template <typename TypeList>
+struct name_dispatch_of;
+
+template <typename ... Ts>
+struct name_dispatch_of<type_list<Ts...>> {
+    static_assert(sizeof...(Ts) > 0, "TypeList is empty");
+    using type = name_dispatch<Ts...>;
+};
+} // namespace detail
+
+/// Calls f.template operator()<T>() for the type T in TypeList with the given fully qualified name,
+/// returns whether there is such T if f returns void, or optional result of f otherwise
+/// Costs one hash, one name comparison and one indirect call, no matter how many types there are
+template <typename TypeList, typename F>
+auto dispatch_by_name(name_type name, F&& f) {
+    return detail::name_dispatch_of<TypeList>::type::call(name, f);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+#ifndef NAMEOF_ENUM_RANGE_MIN
+#define NAMEOF_ENUM_RANGE_MIN -128
+#endif
+
+#ifndef NAMEOF_ENUM_RANGE_MAX
+#define NAMEOF_ENUM_RANGE_MAX 127
+#endif
+
+#ifndef NAMEOF_ENUM_INDEX_MAX
+#define NAMEOF_ENUM_INDEX_MAX 1024
+#endif
+
+/// Range of values probed for enumerators of E, specialize for enums with values outside of the default range
+/// Values out of the range of unscoped enums without a fixed underlying type are skipped
+template <typename E>
+struct enum_range {
+    static constexpr int min = NAMEOF_ENUM_RANGE_MIN;
+    static constexpr int max = NAMEOF_ENUM_RANGE_MAX;
+};
+
+namespace detail {
+template <typename E>
+constexpr int enum_min() {
+    using underlying = std::underlying_type_t<E>;
+    if constexpr (std::is_signed_v<underlying>)
+        return sizeof(underlying) < sizeof(int)
+            ? std::max<int>(enum_range<E>::min, std::numeric_limits<underlying>::min()) : enum_range<E>::min;
+    else
+        return std::max(enum_range<E>::min, 0);
+}
+
+template <typename E>
+constexpr int enum_max() {
+    using underlying = std::underlying_type_t<E>;
+    if constexpr (sizeof(underlying) < sizeof(int))
+        return std::min<int>(enum_range<E>::max, std::numeric_limits<underlying>::max());
+    else
+        return enum_range<E>::max;
+}
+
+template <typename E>
+constexpr long long enum_integer(E value) {
+    return static_cast<long long>(static_cast<std::underlying_type_t<E>>(value));
+}
+
+template <typename E, typename = void>
+struct has_fixed_underlying_type : std::false_type {};
+
+/// list initialization from an integer is only allowed for enums with a fixed underlying type
+template <typename E>
+struct has_fixed_underlying_type<E, std::void_t<decltype(E{ std::underlying_type_t<E>{} })>> : std::true_type {};
+
+template <typename E, int V, typename = void>
+struct is_enum_value : std::false_type {};
+
+#if defined(__GNUC__) && ! defined(__clang__)
+// GCC accepts values out of the range of an enum without a fixed underlying type and only warns about them
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#endif
+
+/// values out of the range of an enum without a fixed underlying type are not constant expressions,
+/// compilers which diagnose them, such as Clang 16+, fail this substitution instead of the whole probe
+template <typename E, int V>
+struct is_enum_value<E, V, std::void_t<std::integral_constant<E, static_cast<E>(V)>>> : std::true_type {};
+
+template <typename E, int V>
+constexpr bool probe_enumerator() {
+    if constexpr (std::disjunction_v<has_fixed_underlying_type<E>, is_enum_value<E, V>>)
+        return is_enumerator_name(name<static_cast<E>(V)>());
+    else
+        return false;
+}
+
+#if defined(__GNUC__) && ! defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+template <typename E, int Min, int ... I>
+constexpr std::array<bool, sizeof...(I)> enum_probe(std::integer_sequence<int, I...>) {
+    return {{ probe_enumerator<E, Min + I>()... }};
+}
+
+template <typename E>
+struct enum_table {
+    static constexpr int min = enum_min<E>();
+    static constexpr int max = enum_max<E>();
+    static_assert(min <= max, "enum_range<E> is empty");
+
+    static constexpr auto probe = enum_probe<E, min>(std::make_integer_sequence<int, max - min + 1>{});
+
+    static constexpr std::size_t count() {
+        std::size_t result = 0;
+        for(const auto valid : probe)
+            result += valid ? 1 : 0;
+        return result;
+    }
+    static_assert(count() != 0, "enum has no enumerators within enum_range<E>");
+
+    static constexpr std::array<E, count()> make_values() {
+        std::array<E, count()> result {};
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < probe.size(); ++i)
+            if (probe[i]) result[n++] = static_cast<E>(min + static_cast<int>(i));
+        return result;
+    }
+    static constexpr auto values = make_values();
+
+    template <std::size_t ... I>
+    static constexpr std::array<name_type, sizeof...(I)> make_names(std::index_sequence<I...>) {
+        return {{ static_nameof<values[I]>()... }};
+    }
+    static constexpr auto names = make_names(std::make_index_sequence<count()>{});
+
+    static constexpr long long first = enum_integer(values.front());
+    static constexpr std::size_t span = static_cast<std::size_t>(enum_integer(values.back()) - first) + 1;
+    /// contiguous enumerators are looked up directly in names
+    static constexpr bool contiguous = span == count();
+    /// enumerators with holes within a moderate span are looked up through a table of indices into names
+    static constexpr bool indexed = ! contiguous && span <= NAMEOF_ENUM_INDEX_MAX;
+    using index_type = std::conditional_t<(count() < std::numeric_limits<unsigned char>::max()),
+                                          unsigned char, unsigned short>;
+
+    static constexpr auto make_indices() {
+        std::array<index_type, indexed ? span : 0> result {};
+        if constexpr (indexed) {
+            for(auto& index : result)
+                index = static_cast<index_type>(count());
+            for(std::size_t i = 0; i < count(); ++i)
+                result[static_cast<std::size_t>(enum_integer(values[i]) - first)] = static_cast<index_type>(i);
+        }
+        return result;
+    }
+    static constexpr auto indices = make_indices();
+
+    /// Returns index of value in values or count() if value is not an enumerator
+    static constexpr std::size_t find(E value) noexcept {
+        // unsigned arithmetic, so values far out of range, e.g. read from the wire, wrap instead of overflowing
+        using unsigned_type = unsigned long long;
+        const auto offset = static_cast<unsigned_type>(enum_integer(value)) - static_cast<unsigned_type>(first);
+        if constexpr (contiguous) {
+            return offset < span ? static_cast<std::size_t>(offset) : count();
+        } else if constexpr (indexed) {
+            return offset < span ? indices[static_cast<std::size_t>(offset)] : count();
+        } else {
+            std::size_t lo = 0, hi = count();
+            const auto key = enum_integer(value);
+            while(lo < hi) {
+                const auto mid = lo + (hi - lo) / 2;
+                if (enum_integer(values[mid]) < key) lo = mid + 1;
+                else hi = mid;
+            }
+            return lo < count() && enum_integer(values[lo]) == key ? lo : count();
+        }
+    }
+
+    static constexpr name_type lookup(E value) noexcept {
+        const auto index = find(value);
+        return index < count() ? names[index] : name_type{};
+    }
+};
+
+template <typename E, std::size_t ... I>
+constexpr std::array<name_type, sizeof...(I)> make_enum_qualified_names(std::index_sequence<I...>) {
+    return {{ static_fully_qualified_nameof<enum_table<E>::values[I]>()... }};
+}
+
+/// Fully qualified names of enumerators, instantiated only when used
+template <typename E>
+inline constexpr auto enum_qualified_names = make_enum_qualified_names<E>(std::make_index_sequence<enum_table<E>::count()>{});
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns true if V is an enumerator of its enum type
+template <auto V>
+constexpr bool is_enumerator() {
+    static_assert(std::is_enum_v<decltype(V)>, "V is not an enum value");
+    return detail::is_enumerator_name(detail::name<V>());
+}
+
+/// Returns name of enumerator V, fails to compile if V is not an enumerator
+template <auto V>
+constexpr name_type enum_name() {
+    static_assert(is_enumerator<V>(), "V is not an enumerator");
+    return static_nameof<V>();
+}
+
+/// Returns name of enumerator value or an empty name if value is not an enumerator within enum_range<E>
+template <typename E>
+constexpr name_type enum_name(E value) noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    return detail::enum_table<E>::lookup(value);
+}
+
+/// Returns fully qualified name of enumerator value or an empty name if value is not an enumerator within enum_range<E>
+template <typename E>
+constexpr name_type enum_fully_qualified_name(E value) noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    const auto index = detail::enum_table<E>::find(value);
+    return index < detail::enum_qualified_names<E>.size() ? detail::enum_qualified_names<E>[index] : name_type{};
+}
+
+/// Returns true if value is an enumerator within enum_range<E>
+template <typename E>
+constexpr bool enum_contains(E value) noexcept {
+    return ! enum_name(value).empty();
+}
+
+/// Returns all enumerators of E within enum_range<E> in ascending order
+template <typename E>
+constexpr const auto& enum_values() noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    return detail::enum_table<E>::values;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+/// Options for enum_cast
+enum class enum_cast_flags : unsigned {
+    none         = 0,
+    ignore_case  = 1, ///< match names ignoring ASCII case
+    strip_prefix = 2, ///< match names with enum_prefix<E>::value removed
+};
+
+constexpr enum_cast_flags operator|(enum_cast_flags lhs, enum_cast_flags rhs) {
+    return static_cast<enum_cast_flags>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+constexpr bool operator&(enum_cast_flags lhs, enum_cast_flags rhs) {
+    return (static_cast<unsigned>(lhs) & static_cast<unsigned>(rhs)) != 0;
+}
+
+/// Prefix removed from enumerator names by enum_cast with enum_cast_flags::strip_prefix, specialize to set one
+template <typename E>
+struct enum_prefix {
+    static constexpr name_type value {};
+};
+
+namespace detail {
+template <typename E, enum_cast_flags Flags>
+struct enum_cast_table {
+    using table = enum_table<E>;
+    static constexpr bool ignore_case = Flags & enum_cast_flags::ignore_case;
+
+    static constexpr auto make_keys() {
+        auto result = table::names;
+        if constexpr (Flags & enum_cast_flags::strip_prefix) {
+            constexpr name_type prefix = enum_prefix<E>::value;
+            for(auto& key : result)
+                if (equal<ignore_case>(key.substr(0, prefix.size()), prefix))
+                    key.remove_prefix(prefix.size());
+        }
+        return result;
+    }
+    static constexpr auto keys = make_keys();
+    static constexpr auto hash = make_perfect_hash<ignore_case>(keys);
+    static_assert(hash.valid, "enumerator names are not unique");
+
+    static constexpr std::optional<E> lookup(name_type name) noexcept {
+        const auto index = find<ignore_case>(hash, keys, name);
+        return index < keys.size() ? std::optional<E>{table::values[index]} : std::nullopt;
+    }
+};
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns enumerator of E with the given name or nullopt if there is none
+template <typename E, enum_cast_flags Flags = enum_cast_flags::none>
+constexpr std::optional<E> enum_cast(name_type name) noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    return detail::enum_cast_table<E, Flags>::lookup(name);
 }
 } // namespace meta
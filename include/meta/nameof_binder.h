@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_binder.h - binding of key/value strings to struct members named by their member pointers
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <charconv>
+
+/*
+ * binder<T, &T::a, &T::b...>::bind(object, key, value) assigns value, parsed from a string, to the member named key
+ * Keys are names of the members, nameof<&T::a>(), dispatched with a compile-time perfect hash,
+ * so a call costs one hash, one key comparison and one std::from_chars, with no allocations
+ * Supported member types: arithmetic types, bool (true, false, 1, 0), enums (by enumerator name, see enum_cast)
+ * and std::string_view, which refers to the value string, so it must outlive the object
+ */
+
+namespace meta {
+enum class bind_status { ok, unknown_key, invalid_value, out_of_range };
+
+namespace detail {
+template <typename M>
+bind_status parse_value(M& member, name_type value) noexcept {
+    if constexpr (std::is_same_v<M, bool>) {
+        if (value == "true" || value == "1") member = true;
+        else if (value == "false" || value == "0") member = false;
+        else return bind_status::invalid_value;
+        return bind_status::ok;
+    } else if constexpr (std::is_enum_v<M>) {
+        const auto result = enum_cast<M>(value);
+        if (! result)
+            return bind_status::invalid_value;
+        member = *result;
+        return bind_status::ok;
+    } else if constexpr (std::is_same_v<M, name_type>) {
+        member = value;
+        return bind_status::ok;
+    } else {
+        static_assert(std::is_arithmetic_v<M>, "unsupported member type");
+        const auto last = value.data() + value.size();
+        M result {};
+        const auto [ptr, error] = std::from_chars(value.data(), last, result);
+        if (error == std::errc::result_out_of_range)
+            return bind_status::out_of_range;
+        if (error != std::errc{} || ptr != last)
+            return bind_status::invalid_value;
+        member = result;
+        return bind_status::ok;
+    }
+}
+
+template <typename T, auto Member>
+bind_status bind_member(T& object, name_type value) noexcept {
+    return parse_value(object.*Member, value);
+}
+
+template <typename T, auto Member>
+inline constexpr bool is_member_of = std::is_member_object_pointer_v<decltype(Member)> &&
+    std::is_invocable_v<decltype(Member), const T&>;
+} // namespace detail
+
+/// Binds key/value strings to members of T, keys are names of members
+template <typename T, auto ... Members>
+struct binder {
+    static_assert((detail::is_member_of<T, Members> && ...), "Members are not pointers to data members of T");
+
+    static constexpr std::array<name_type, sizeof...(Members)> keys {{ name_type{nameof<Members>()}... }};
+    static constexpr auto hash = detail::make_perfect_hash<false>(keys);
+    static_assert(hash.valid, "member names are not unique");
+
+    /// Returns index of the member named key, count() if there is none
+    static constexpr std::size_t find(name_type key) noexcept {
+        return detail::find<false>(hash, keys, key);
+    }
+
+    static constexpr std::size_t count() noexcept { return sizeof...(Members); }
+
+    /// Parses value and assigns it to the member named key, object is not changed unless the status is ok
+    static bind_status bind(T& object, name_type key, name_type value) noexcept {
+        const auto index = find(key);
+        return index < count() ? setters[index](object, value) : bind_status::unknown_key;
+    }
+private:
+    using setter = bind_status (*)(T&, name_type) noexcept;
+    static constexpr setter setters[sizeof...(Members) + 1] { &detail::bind_member<T, Members>..., nullptr };
+};
+
+/// Parses value and assigns it to the member of object named key, e.g. bind<&Config::port>(config, "port", "8080")
+template <auto ... Members, typename T>
+bind_status bind(T& object, name_type key, name_type value) noexcept {
+    return binder<T, Members...>::bind(object, key, value);
+}
+} // namespace meta
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_dynamic.h - names of dynamic types of polymorphic objects
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <meta/nameof_section.h>
+#include <atomic>
+#include <cstdint>
+#include <typeinfo>
+
+/*
+ * Dynamic type names for objects held through base references, opt-in per type
+ * Types are registered with NAMEOF_REGISTER_DYNAMIC(Type) or by deriving from dynamic_name<Type>,
+ * which map std::type_info of the type to its static_fully_qualified_nameof in a lock-free open addressing table
+ * Lookups never lock or allocate, registration may run concurrently with lookups
+ */
+
+#ifndef NAMEOF_DYNAMIC_CAPACITY
+#define NAMEOF_DYNAMIC_CAPACITY 1024
+#endif
+
+namespace meta {
+namespace detail {
+struct dynamic_name_slot {
+    std::atomic<const std::type_info*> type { nullptr };
+    std::atomic<const name_type*> name { nullptr };
+};
+
+static_assert((NAMEOF_DYNAMIC_CAPACITY & (NAMEOF_DYNAMIC_CAPACITY - 1)) == 0,
+    "NAMEOF_DYNAMIC_CAPACITY must be a power of 2");
+
+inline dynamic_name_slot dynamic_names[NAMEOF_DYNAMIC_CAPACITY] {};
+
+/// Type names are keyed by std::type_info, which may have more than one instance per type across shared objects,
+/// so slots are found by hash_code, the same for equal type_info, and matched by type_info equality
+inline std::size_t dynamic_name_hash(const std::type_info& type) {
+    return static_cast<std::size_t>(mix(type.hash_code()));
+}
+
+inline bool add_dynamic_name(const std::type_info& type, const name_type& name) {
+    constexpr std::size_t mask = NAMEOF_DYNAMIC_CAPACITY - 1;
+    for(std::size_t i = 0, slot = dynamic_name_hash(type) & mask; i < NAMEOF_DYNAMIC_CAPACITY; ++i, slot = (slot + 1) & mask) {
+        const std::type_info* expected = nullptr;
+        auto& entry = dynamic_names[slot];
+        if (entry.type.compare_exchange_strong(expected, &type, std::memory_order_acq_rel) || *expected == type) {
+            entry.name.store(&name, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+inline constexpr name_type dynamic_type_name = static_fully_qualified_nameof<T>();
+} // namespace detail
+
+/// Registers name of polymorphic type T for dynamic_nameof, returns false if the table is full
+template <typename T>
+bool register_dynamic_name() {
+    static_assert(std::is_polymorphic_v<T>, "T must be a polymorphic type");
+    return detail::add_dynamic_name(typeid(T), detail::dynamic_type_name<T>);
+}
+
+/// Returns fully qualified name of a registered type, empty name for types not registered
+inline name_type dynamic_nameof(const std::type_info& type) {
+    constexpr std::size_t mask = NAMEOF_DYNAMIC_CAPACITY - 1;
+    for(std::size_t i = 0, slot = detail::dynamic_name_hash(type) & mask; i < NAMEOF_DYNAMIC_CAPACITY; ++i, slot = (slot + 1) & mask) {
+        const auto& entry = detail::dynamic_names[slot];
+        const auto key = entry.type.load(std::memory_order_acquire);
+        if (key == nullptr)
+            break;
+        if (key == &type || *key == type) {
+            const auto name = entry.name.load(std::memory_order_acquire);
+            return name ? *name : name_type{};
+        }
+    }
+    return {};
+}
+
+/// Returns fully qualified name of the dynamic type of object, same as fully_qualified_nameof<Derived>()
+/// Returns empty name if the dynamic type is not registered
+template <typename Base>
+name_type dynamic_nameof(const Base& object) {
+    static_assert(std::is_polymorphic_v<Base>, "Base must be a polymorphic type");
+    return dynamic_nameof(typeid(object));
+}
+
+/// CRTP mixin registering name of Derived on first construction
+template <typename Derived>
+class dynamic_name {
+protected:
+    dynamic_name() noexcept {
+        static const bool registered = register_dynamic_name<Derived>();
+        static_cast<void>(registered);
+    }
+    dynamic_name(const dynamic_name&) noexcept = default;
+    dynamic_name& operator=(const dynamic_name&) noexcept = default;
+    ~dynamic_name() = default;
+};
+} // namespace meta
+
+/// Registers name of a polymorphic type at static initialization, used at namespace scope
+#define NAMEOF_REGISTER_DYNAMIC(...) \
+    static const bool NAMEOF_CONCAT(nameof_dynamic_registered_, __COUNTER__) = \
+        ::meta::register_dynamic_name<__VA_ARGS__>()
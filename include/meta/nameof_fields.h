@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_fields.h - names of aggregate members
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <cstring>
+#include <memory>
+#include <tuple>
+
+/*
+ * field_names<T>() and for_each_field(object, function) for aggregates without base classes,
+ * array members and reference members
+ * member_name_at_offset<T>(offset) and member_name(pointer) map byte offsets to member names through a compile-time table
+ * of offsets, taken from addresses of members of a constant object, so alignas and [[no_unique_address]] members are
+ * accounted for, members sharing an offset are told apart by type
+ * Member names are inferred from pointers to subobjects of a never defined static object of type T,
+ * which requires C++20 (pointers to subobjects as template arguments)
+ */
+
+#if __cpp_nontype_template_args >= 201911L
+
+namespace meta {
+namespace detail {
+inline constexpr std::size_t max_fields = 32;
+
+struct any_field {
+    template <typename T>
+    constexpr operator T() const noexcept; // never defined, used in unevaluated context only
+};
+
+template <typename T, std::size_t ... I>
+constexpr bool is_brace_constructible(std::index_sequence<I...>) {
+    return requires { T{ (void(I), any_field{})... }; };
+}
+
+template <typename T, std::size_t N = 0>
+constexpr std::size_t count_fields() {
+    if constexpr (N <= max_fields && is_brace_constructible<T>(std::make_index_sequence<N + 1>{}))
+        return count_fields<T, N + 1>();
+    else
+        return N;
+}
+
+template <typename T>
+inline constexpr std::size_t field_count = count_fields<std::remove_cv_t<T>>();
+
+template <typename T>
+constexpr auto tie_fields(T& object) {
+    constexpr auto N = field_count<T>;
+    static_assert(N <= max_fields, "aggregate has too many members");
+    if constexpr (N == 1) {
+        auto& [f0] = object;
+        return std::tie(f0);
+    } else if constexpr (N == 2) {
+        auto& [f0, f1] = object;
+        return std::tie(f0, f1);
+    } else if constexpr (N == 3) {
+        auto& [f0, f1, f2] = object;
+        return std::tie(f0, f1, f2);
+    } else if constexpr (N == 4) {
+        auto& [f0, f1, f2, f3] = object;
+        return std::tie(f0, f1, f2, f3);
+    } else if constexpr (N == 5) {
+        auto& [f0, f1, f2, f3, f4] = object;
+        return std::tie(f0, f1, f2, f3, f4);
+    } else if constexpr (N == 6) {
+        auto& [f0, f1, f2, f3, f4, f5] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5);
+    } else if constexpr (N == 7) {
+        auto& [f0, f1, f2, f3, f4, f5, f6] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6);
+    } else if constexpr (N == 8) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+    } else if constexpr (N == 9) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+    } else if constexpr (N == 10) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+    } else if constexpr (N == 11) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+    } else if constexpr (N == 12) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+    } else if constexpr (N == 13) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+    } else if constexpr (N == 14) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+    } else if constexpr (N == 15) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+    } else if constexpr (N == 16) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+    } else if constexpr (N == 17) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+    } else if constexpr (N == 18) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+    } else if constexpr (N == 19) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+    } else if constexpr (N == 20) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19);
+    } else if constexpr (N == 21) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20);
+    } else if constexpr (N == 22) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21);
+    } else if constexpr (N == 23) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22);
+    } else if constexpr (N == 24) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23);
+    } else if constexpr (N == 25) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24);
+    } else if constexpr (N == 26) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25);
+    } else if constexpr (N == 27) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26);
+    } else if constexpr (N == 28) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27);
+    } else if constexpr (N == 29) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28);
+    } else if constexpr (N == 30) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29);
+    } else if constexpr (N == 31) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30);
+    } else if constexpr (N == 32) {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31] = object;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31);
+    } else {
+        return std::tie();
+    }
+}
+
+constexpr name_type parse_member_name(name_type name) {
+    auto pos = name.size();
+    while(pos > 0 && is_identifier_char(name[pos - 1]))
+        --pos;
+    return name.substr(pos);
+}
+
+template <typename T>
+struct field_object_wrapper {
+    T value;
+};
+
+/// Never defined object, its members are named only in __PRETTY_FUNCTION__/__FUNCSIG__
+template <typename T>
+extern const field_object_wrapper<T> field_object;
+
+template <typename T, std::size_t I>
+constexpr name_type field_name() {
+    return parse_member_name(parse_name(name<&std::get<I>(tie_fields(field_object<T>.value))>()));
+}
+
+template <typename T, std::size_t I>
+inline constexpr auto static_field_name = make_static_name<field_name<T, I>().size()>(field_name<T, I>());
+
+template <typename T, std::size_t ... I>
+constexpr std::array<name_type, sizeof...(I)> make_field_names(std::index_sequence<I...>) {
+    return {{ static_field_name<T, I>.view()... }};
+}
+
+template <typename T>
+inline constexpr auto field_names = make_field_names<T>(std::make_index_sequence<field_count<T>>{});
+
+template <typename T, std::size_t I>
+using field_type = std::remove_reference_t<std::tuple_element_t<I, decltype(tie_fields(std::declval<T&>()))>>;
+
+template <typename T, std::size_t ... I>
+constexpr std::array<std::size_t, sizeof...(I)> make_field_sizes(std::index_sequence<I...>) {
+    return {{ sizeof(field_type<T, I>)... }};
+}
+
+template <typename T>
+inline constexpr auto field_sizes = make_field_sizes<T>(std::make_index_sequence<field_count<T>>{});
+
+/// Storage for an object of type T which is never constructed, its members are used only for their addresses
+template <typename T>
+union field_layout_object {
+    constexpr field_layout_object() noexcept : bytes {} {}
+    constexpr ~field_layout_object() {}
+    unsigned char bytes[sizeof(T)];
+    T value;
+};
+
+template <typename T>
+inline constexpr field_layout_object<T> field_layout_storage {};
+
+template <typename T>
+struct field_layout {
+    std::array<std::size_t, field_count<T>> offsets; ///< offsets of members in declaration order
+    std::array<std::size_t, field_count<T>> order;   ///< indices of members ordered by offset, empty ones first on ties
+    std::array<std::size_t, field_count<T>> extents; ///< numbers of bytes occupied by members, zero for empty ones
+};
+
+/// Returns offset of a member of field_layout_storage<T>, comparing its address with addresses of bytes of the storage,
+/// starting at hint, as constant expressions may compare but not subtract addresses of different subobjects
+template <typename T>
+constexpr std::size_t storage_offset(const void* member, std::size_t hint) {
+    for(std::size_t i = 0; i < sizeof(T); ++i) {
+        const auto offset = (hint + i) % sizeof(T);
+        if (member == static_cast<const void*>(&field_layout_storage<T>.bytes[offset]))
+            return offset;
+    }
+    return sizeof(T);
+}
+
+template <typename T, std::size_t ... I>
+constexpr field_layout<T> make_field_layout(std::index_sequence<I...>) {
+    const auto fields = tie_fields(field_layout_storage<T>.value);
+    const void* const addresses[] = { static_cast<const void*>(std::addressof(std::get<I>(fields)))..., nullptr };
+    field_layout<T> result { {}, {{ I... }}, {{ (std::is_empty_v<field_type<T, I>> ? 0 : sizeof(field_type<T, I>))... }} };
+    std::size_t hint = 0;
+    for(std::size_t i = 0; i < result.offsets.size(); ++i)
+        hint = result.offsets[i] = storage_offset<T>(addresses[i], hint);
+    // [[no_unique_address]] members may be placed out of declaration order or share offset with other members
+    const auto less = [&result](std::size_t lhs, std::size_t rhs) {
+        return result.offsets[lhs] < result.offsets[rhs] ||
+            (result.offsets[lhs] == result.offsets[rhs] && result.extents[lhs] == 0 && result.extents[rhs] != 0);
+    };
+    for(std::size_t i = 1; i < result.order.size(); ++i) {
+        for(auto j = i; j > 0 && less(result.order[j], result.order[j - 1]); --j) {
+            const auto index = result.order[j];
+            result.order[j] = result.order[j - 1];
+            result.order[j - 1] = index;
+        }
+    }
+    return result;
+}
+
+/// Offsets of members of T, taken at compile time from addresses of members of field_layout_storage<T>
+template <typename T>
+inline constexpr auto field_offsets = make_field_layout<T>(std::make_index_sequence<field_count<T>>{});
+
+template <typename T, std::size_t ... I>
+constexpr bool has_field_offsets(std::index_sequence<I...>) {
+    return ((field_offsets<T>.offsets[I] < sizeof(T)) && ...);
+}
+
+/// Returns position in field_offsets<T>.order of the last member with offset not greater than offset, or count
+template <typename T>
+constexpr std::size_t field_position_at(std::size_t offset) noexcept {
+    static_assert(has_field_offsets<T>(std::make_index_sequence<field_count<T>>{}), "member offsets are not found");
+    const auto& layout = field_offsets<T>;
+    std::size_t base = 0, size = layout.order.size();
+    if (size == 0 || layout.offsets[layout.order[0]] > offset)
+        return layout.order.size();
+    while(size > 1) { // branchless lower bound
+        const auto half = size / 2;
+        base = layout.offsets[layout.order[base + half]] <= offset ? base + half : base;
+        size -= half;
+    }
+    return base;
+}
+
+/// Returns index of the member occupying byte at offset or field_count<T> for padding and offsets out of T
+template <typename T>
+constexpr std::size_t field_index_at(std::size_t offset) noexcept {
+    const auto& layout = field_offsets<T>;
+    auto position = field_position_at<T>(offset);
+    while(position < layout.order.size() && layout.extents[layout.order[position]] == 0)
+        position = position > 0 ? position - 1 : layout.order.size();
+    if (position == layout.order.size())
+        return position;
+    const auto index = layout.order[position];
+    return offset - layout.offsets[index] < layout.extents[index] ? index : layout.order.size();
+}
+
+/// Returns index of the member of type M at offset or field_count<T> if there is none,
+/// members sharing an offset, such as [[no_unique_address]] ones, have distinct types
+template <typename T, typename M, std::size_t ... I>
+constexpr std::size_t field_index_of(std::size_t offset, std::index_sequence<I...>) noexcept {
+    constexpr bool same_type[] = { std::is_same_v<field_type<T, I>, M>..., false };
+    const auto& layout = field_offsets<T>;
+    for(auto position = field_position_at<T>(offset);
+        position < layout.order.size() && layout.offsets[layout.order[position]] == offset; --position) {
+        if (same_type[layout.order[position]])
+            return layout.order[position];
+    }
+    return layout.order.size();
+}
+
+/// Itanium and MSVC ABIs represent pointers to data members of classes without virtual bases as offsets
+template <typename T, typename M>
+std::size_t member_offset(M T::* member) noexcept {
+    std::conditional_t<sizeof(member) == sizeof(std::ptrdiff_t), std::ptrdiff_t, std::int32_t> offset {};
+    static_assert(sizeof(member) == sizeof(offset), "unsupported data member pointer representation");
+    std::memcpy(&offset, &member, sizeof(offset));
+    return static_cast<std::size_t>(offset);
+}
+
+template <typename T, typename F, std::size_t ... I>
+constexpr void for_each_field(T& object, F&& function, std::index_sequence<I...>) {
+    auto fields = tie_fields(object);
+    (function(field_names<std::remove_cv_t<T>>[I], std::get<I>(fields)), ...);
+}
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns number of members of aggregate T
+template <typename T>
+constexpr std::size_t field_count() {
+    static_assert(std::is_aggregate_v<T>, "T is not an aggregate");
+    return detail::field_count<T>;
+}
+
+/// Returns names of members of aggregate T in declaration order
+template <typename T>
+constexpr const auto& field_names() {
+    static_assert(std::is_aggregate_v<T>, "T is not an aggregate");
+    return detail::field_names<std::remove_cv_t<T>>;
+}
+
+/// Returns tuple of references to members of aggregate object
+template <typename T>
+constexpr auto tie_fields(T& object) {
+    static_assert(std::is_aggregate_v<std::remove_cv_t<T>>, "T is not an aggregate");
+    return detail::tie_fields(object);
+}
+
+/// Returns name of the member of aggregate T occupying byte at offset, empty name for padding and offsets out of T
+template <typename T>
+constexpr name_type member_name_at_offset(std::size_t offset) noexcept {
+    static_assert(std::is_aggregate_v<T>, "T is not an aggregate");
+    using type = std::remove_cv_t<T>;
+    const auto index = detail::field_index_at<type>(offset);
+    return index < detail::field_count<type> ? detail::field_names<type>[index] : name_type{};
+}
+
+/// Returns name of the member of aggregate T selected by pointer to data member, empty name for null pointer
+template <typename T, typename M>
+name_type member_name(M T::* member) noexcept {
+    static_assert(std::is_aggregate_v<T>, "T is not an aggregate");
+    using type = std::remove_cv_t<T>;
+    const auto index = detail::field_index_of<type, M>(detail::member_offset(member),
+        std::make_index_sequence<detail::field_count<type>>{});
+    return index < detail::field_count<type> ? detail::field_names<type>[index] : name_type{};
+}
+
+/// Calls function(name, member) for each member of aggregate object in declaration order
+template <typename T, typename F>
+constexpr void for_each_field(T& object, F&& function) {
+    static_assert(std::is_aggregate_v<std::remove_cv_t<T>>, "T is not an aggregate");
+    detail::for_each_field(object, std::forward<F>(function), std::make_index_sequence<detail::field_count<T>>{});
+}
+} // namespace meta
+#endif
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_flags.h - formatting and parsing of bit flag enums
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <charconv>
+#include <system_error>
+
+/*
+ * Bit flag enums as "A|B|C" strings, driven by a compile-time table of the single-bit enumerators of E
+ * Bits which are not enumerators are written and parsed as a decimal number
+ * Enums with a fixed underlying type are probed for all bits of the type, unscoped enums without one
+ * only for bits not greater than enum_range<E>::max, since other values are not valid for them
+ */
+
+namespace meta {
+namespace detail {
+template <typename E>
+using flag_integer = std::make_unsigned_t<std::underlying_type_t<E>>;
+
+template <typename E>
+constexpr E to_flags(flag_integer<E> bits) {
+    return static_cast<E>(static_cast<std::underlying_type_t<E>>(bits));
+}
+
+template <typename E>
+constexpr flag_integer<E> from_flags(E value) {
+    return static_cast<flag_integer<E>>(static_cast<std::underlying_type_t<E>>(value));
+}
+
+/// Returns number of low bits which are valid values of E
+template <typename E>
+constexpr std::size_t flag_bits() {
+    constexpr std::size_t digits = std::numeric_limits<flag_integer<E>>::digits;
+    if constexpr (has_fixed_underlying_type<E>::value)
+        return digits;
+    std::size_t result = 0;
+    while(result < digits && result < 31 && (1 << result) <= enum_range<E>::max)
+        ++result;
+    return result;
+}
+
+template <typename E, std::size_t ... I>
+constexpr std::array<bool, sizeof...(I)> flag_probe(std::index_sequence<I...>) {
+    using integer = flag_integer<E>;
+    return {{ is_enumerator_name(name<to_flags<E>(static_cast<integer>(integer{1} << I))>())... }};
+}
+
+template <typename E>
+struct flag_table {
+    using integer = flag_integer<E>;
+    static constexpr std::size_t bits = flag_bits<E>();
+    /// bits which may be set in a value of E
+    static constexpr integer mask = bits < std::numeric_limits<integer>::digits
+        ? static_cast<integer>((integer{1} << bits) - 1) : static_cast<integer>(~integer{0});
+    static constexpr auto probe = flag_probe<E>(std::make_index_sequence<bits>{});
+
+    static constexpr std::size_t count() {
+        std::size_t result = 0;
+        for(const auto valid : probe)
+            result += valid ? 1 : 0;
+        return result;
+    }
+    static_assert(count() != 0, "enum has no single bit enumerators");
+
+    static constexpr std::array<integer, count()> make_values() {
+        std::array<integer, count()> result {};
+        std::size_t n = 0;
+        for(std::size_t i = 0; i < bits; ++i)
+            if (probe[i]) result[n++] = static_cast<integer>(integer{1} << i);
+        return result;
+    }
+    static constexpr auto values = make_values();
+
+    template <std::size_t ... I>
+    static constexpr std::array<name_type, sizeof...(I)> make_names(std::index_sequence<I...>) {
+        return {{ static_nameof<to_flags<E>(values[I])>()... }};
+    }
+    static constexpr auto names = make_names(std::make_index_sequence<count()>{});
+
+    /// names of all flags, separators and a number for the remaining bits
+    static constexpr std::size_t max_size() {
+        std::size_t result = count() + std::numeric_limits<integer>::digits10 + 1;
+        for(const auto name : names)
+            result += name.size();
+        return result;
+    }
+
+    static constexpr auto hash = make_perfect_hash<false>(names);
+    static_assert(hash.valid, "enumerator names are not unique");
+};
+} // namespace detail
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Returns buffer size sufficient for flags_to_chars with any value of E
+template <typename E>
+constexpr std::size_t flags_max_size() {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    return detail::flag_table<E>::max_size();
+}
+
+/// Writes value as names of its single-bit enumerators delimited with Separator, bits not named are written as a number
+/// Returns pointer past the last written character, or errc::value_too_large if value does not fit
+template <typename E, char Separator = '|'>
+std::to_chars_result flags_to_chars(E value, char* buffer, std::size_t size) {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    using table = detail::flag_table<E>;
+    using integer = typename table::integer;
+    auto bits = detail::from_flags(value);
+    char* pos = buffer;
+    char* const end = buffer + size;
+    for(std::size_t i = 0; i < table::count(); ++i) {
+        if ((bits & table::values[i]) == 0)
+            continue;
+        const auto name = table::names[i];
+        const auto needed = name.size() + (pos != buffer ? 1 : 0);
+        if (static_cast<std::size_t>(end - pos) < needed)
+            return { end, std::errc::value_too_large };
+        if (pos != buffer)
+            *pos++ = Separator;
+        pos = std::copy(name.begin(), name.end(), pos);
+        bits = static_cast<integer>(bits & ~table::values[i]);
+    }
+    if (bits != 0) {
+        if (pos != buffer) {
+            if (pos == end)
+                return { end, std::errc::value_too_large };
+            *pos++ = Separator;
+        }
+        return std::to_chars(pos, end, bits);
+    }
+    return { pos, std::errc{} };
+}
+
+/// Parses names of single-bit enumerators or decimal numbers delimited with Separator, an empty string gives E{}
+/// Numbers with bits which are not valid for E are rejected
+template <typename E, char Separator = '|'>
+std::optional<E> flags_from_string(name_type text) noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    using table = detail::flag_table<E>;
+    using integer = typename table::integer;
+    integer bits = 0;
+    if (text.empty())
+        return E{};
+    for(;;) {
+        const auto pos = text.find(Separator);
+        const auto token = text.substr(0, pos);
+        if (token.empty())
+            return std::nullopt;
+        if (detail::is_digit(token.front())) {
+            integer number = 0;
+            const auto result = std::from_chars(token.data(), token.data() + token.size(), number);
+            if (result.ec != std::errc{} || result.ptr != token.data() + token.size() || (number & ~table::mask) != 0)
+                return std::nullopt;
+            bits = static_cast<integer>(bits | number);
+        } else {
+            const auto index = detail::find<false>(table::hash, table::names, token);
+            if (index == table::count())
+                return std::nullopt;
+            bits = static_cast<integer>(bits | table::values[index]);
+        }
+        if (pos == name_type::npos)
+            break;
+        text.remove_prefix(pos + 1);
+    }
+    return detail::to_flags<E>(bits);
+}
+} // namespace meta
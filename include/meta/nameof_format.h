@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_format.h - std::format and fmt formatters for enums
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <charconv>
+#include <iterator>
+
+/*
+ * Formats values of enums opted in with enable_enum_format<E> by their names, with no allocation
+ *   {}   - enumerator name, the numeric value for values which are not enumerators
+ *   {:q} - fully qualified enumerator name
+ *   {:d} - enumerator name, the numeric value for values which are not enumerators, same as {}
+ * Enum options go first and are followed by the standard string spec, e.g. {:q>20} or {:*^10}
+ * std::formatter is specialized if <format> is available, fmt::formatter if fmt is included before this header
+ */
+
+namespace meta {
+/// Enables std::formatter and fmt::formatter for E, specialize with value = true to opt in
+template <typename E>
+struct enable_enum_format {
+    static constexpr bool value = false;
+};
+
+struct enum_format_spec {
+    bool qualified = false;
+
+    /// Parses enum options of format spec, returns position of the first character which is not one
+    template <typename Iterator>
+    constexpr Iterator parse(Iterator begin, Iterator end) {
+        for(; begin != end; ++begin) {
+            if (*begin == 'q') qualified = true;
+            else if (*begin != 'd') break; // numeric fallback is always on
+        }
+        return begin;
+    }
+
+    /// Returns text of value, numeric values of values which are not enumerators are written to buffer
+    template <typename E>
+    name_type text(E value, char (&buffer)[24]) const {
+        const auto name = qualified ? enum_fully_qualified_name(value) : enum_name(value);
+        if (! name.empty())
+            return name;
+        const auto result = std::to_chars(std::begin(buffer), std::end(buffer), +static_cast<std::underlying_type_t<E>>(value));
+        return { buffer, static_cast<std::size_t>(result.ptr - buffer) };
+    }
+
+    template <typename E, typename OutputIterator>
+    OutputIterator format(E value, OutputIterator out) const {
+        char buffer[24];
+        const auto result = text(value, buffer);
+        return std::copy(result.begin(), result.end(), out);
+    }
+};
+} // namespace meta
+
+#if __has_include(<format>)
+#include <format>
+#if defined(__cpp_lib_format)
+template <typename E>
+    requires (std::is_enum_v<E> && meta::enable_enum_format<E>::value)
+struct std::formatter<E, char> {
+    meta::enum_format_spec spec {};
+    std::formatter<std::string_view, char> writer {};
+
+    constexpr auto parse(std::format_parse_context& context) {
+        context.advance_to(spec.parse(context.begin(), context.end()));
+        return writer.parse(context);
+    }
+
+    template <typename Context>
+    auto format(E value, Context& context) const {
+        char buffer[24];
+        return writer.format(spec.text(value, buffer), context);
+    }
+};
+#endif
+#endif
+
+#if defined(FMT_VERSION)
+template <typename E>
+struct fmt::formatter<E, char, std::enable_if_t<std::is_enum_v<E> && meta::enable_enum_format<E>::value>> {
+    meta::enum_format_spec spec {};
+    fmt::formatter<fmt::string_view, char> writer {};
+
+    constexpr auto parse(fmt::format_parse_context& context) {
+        context.advance_to(spec.parse(context.begin(), context.end()));
+        return writer.parse(context);
+    }
+
+    template <typename Context>
+    auto format(E value, Context& context) const {
+        char buffer[24];
+        const auto text = spec.text(value, buffer);
+        return writer.format(fmt::string_view{ text.data(), text.size() }, context);
+    }
+};
+#endif
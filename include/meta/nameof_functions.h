@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_functions.h - names of registered functions by their addresses
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <meta/nameof_section.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#if defined(__linux__) && __has_include(<link.h>)
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define NAMEOF_FUNCTION_SIZES 1
+#else
+#define NAMEOF_FUNCTION_SIZES 0
+#endif
+
+/*
+ * Address to name table for functions registered with NAMEOF_REGISTER_FUNCTION(&function)
+ * Registrations are constant data gathered by the linker in section nameof_functions
+ * The entries are resolved and sorted in place once, by the first lookup, there are no static initializers,
+ * lookups never lock or allocate and are safe to call from signal handlers,
+ * lookups made while the table is being sorted return an empty name
+ * name_of_code_address matches only the first address of a function, unless sizes of functions are loaded
+ * with load_function_sizes(), which on Linux reads the symbol table of the executable or shared object,
+ * it is not async-signal-safe and is meant to be called once at startup, before lookups from other threads
+ * Each executable or shared object has a table of its own functions
+ * Supported with GCC and Clang on ELF targets and with MSVC, elsewhere lookups return an empty name
+ */
+
+namespace meta {
+namespace detail {
+struct function_entry {
+    const void* address;
+    const void* (*resolve)();
+    const name_type* name;
+    std::size_t size;
+};
+
+template <auto F>
+inline constexpr name_type function_name = static_fully_qualified_nameof<F>();
+
+/// Returns code address of a function or of a non-virtual member function, nullptr for a virtual one
+/// Member function pointers are decoded per the Itanium C++ ABI, with its ARM variant, or per the MSVC ABI
+template <auto F>
+const void* function_address() {
+    if constexpr (std::is_member_function_pointer_v<decltype(F)>) {
+        struct { std::uintptr_t pointer; std::ptrdiff_t adjustment; } pmf {};
+        static_assert(sizeof(F) <= sizeof(pmf), "unsupported member function pointer representation");
+        const auto member = F;
+        std::memcpy(&pmf, &member, sizeof(member));
+#if defined(_MSC_VER)
+        return reinterpret_cast<const void*>(pmf.pointer);
+#elif defined(__arm__) || defined(__aarch64__) || defined(__mips__) || defined(__wasm__)
+        // ARM variant of Itanium C++ ABI, odd adjustment marks an offset in the virtual table
+        return (pmf.adjustment & 1) ? nullptr : reinterpret_cast<const void*>(pmf.pointer);
+#else
+        // Itanium C++ ABI, odd pointer is an offset in the virtual table
+        return (pmf.pointer & 1) ? nullptr : reinterpret_cast<const void*>(pmf.pointer);
+#endif
+    } else {
+        return reinterpret_cast<const void*>(F);
+    }
+}
+} // namespace detail
+} // namespace meta
+
+NAMEOF_SECTION(nameof_functions, ::meta::detail::function_entry)
+
+namespace meta {
+namespace detail {
+inline std::atomic<section_state> functions_state { section_state::unsorted };
+inline std::atomic<section_state> function_sizes_state { section_state::unsorted };
+
+inline bool less_address(const function_entry& lhs, const function_entry& rhs) {
+    return std::less<const void*>{}(lhs.address, rhs.address);
+}
+
+#if NAMEOF_FUNCTION_SIZES
+struct loaded_object {
+    std::uintptr_t address;
+    const char* path;
+    ElfW(Addr) bias;
+};
+
+inline int find_loaded_object(dl_phdr_info* info, std::size_t, void* data) {
+    auto& object = *static_cast<loaded_object*>(data);
+    for(ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+        const auto& segment = info->dlpi_phdr[i];
+        const auto start = info->dlpi_addr + segment.p_vaddr;
+        if (segment.p_type == PT_LOAD && object.address >= start && object.address - start < segment.p_memsz) {
+            object.path = *info->dlpi_name ? info->dlpi_name : "/proc/self/exe";
+            object.bias = info->dlpi_addr;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/// Sets sizes of entries, sorted by address, from function symbols of an ELF image loaded at bias
+inline void set_function_sizes(const unsigned char* image, std::size_t size, ElfW(Addr) bias,
+                               function_entry* first, function_entry* last) {
+    const auto& header = *reinterpret_cast<const ElfW(Ehdr)*>(image);
+    if (std::memcmp(header.e_ident, ELFMAG, SELFMAG) != 0 || header.e_shentsize != sizeof(ElfW(Shdr)) ||
+        header.e_shoff > size || (size - header.e_shoff) / sizeof(ElfW(Shdr)) < header.e_shnum)
+        return;
+    const auto sections = reinterpret_cast<const ElfW(Shdr)*>(image + header.e_shoff);
+    for(std::size_t i = 0; i < header.e_shnum; ++i) {
+        const auto& section = sections[i];
+        if ((section.sh_type != SHT_SYMTAB && section.sh_type != SHT_DYNSYM) || section.sh_offset > size ||
+            section.sh_size > size - section.sh_offset)
+            continue;
+        const auto symbols = reinterpret_cast<const ElfW(Sym)*>(image + section.sh_offset);
+        for(std::size_t n = 0; n < section.sh_size / sizeof(ElfW(Sym)); ++n) {
+            const auto& symbol = symbols[n];
+            if ((symbol.st_info & 0xf) != STT_FUNC || symbol.st_shndx == SHN_UNDEF || symbol.st_size == 0)
+                continue;
+            const function_entry key { reinterpret_cast<const void*>(bias + symbol.st_value), nullptr, nullptr, 0 };
+            for(auto entry = std::lower_bound(first, last, key, less_address); entry != last && entry->address == key.address; ++entry)
+                entry->size = symbol.st_size;
+        }
+    }
+}
+
+/// Sets sizes of entries, sorted by address, from the object file they are loaded from
+inline void resolve_function_sizes(function_entry* first, function_entry* last) {
+    loaded_object object { reinterpret_cast<std::uintptr_t>(first), nullptr, 0 };
+    if (dl_iterate_phdr(find_loaded_object, &object) == 0)
+        return;
+    const int file = ::open(object.path, O_RDONLY | O_CLOEXEC);
+    if (file < 0)
+        return;
+    struct stat status {};
+    const auto size = ::fstat(file, &status) == 0 ? static_cast<std::size_t>(status.st_size) : 0;
+    const auto image = size >= sizeof(ElfW(Ehdr)) ? ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0) : MAP_FAILED;
+    ::close(file);
+    if (image == MAP_FAILED)
+        return;
+    set_function_sizes(static_cast<const unsigned char*>(image), size, object.bias, first, last);
+    ::munmap(image, size);
+}
+#endif
+
+/// Resolves and sorts registered functions on first call, returns false while another call is sorting them
+inline bool sort_functions() {
+    return sort_section_once(functions_state, [] {
+        const auto first = nameof_functions_first(), last = nameof_functions_last();
+        if (first == nullptr || last == nullptr)
+            return;
+        for(auto entry = first; entry != last; ++entry)
+            entry->address = entry->resolve ? entry->resolve() : nullptr;
+        std::sort(first, last, less_address);
+    });
+}
+
+/// Returns the last entry with address not greater than address, nullptr if there is none
+inline const function_entry* find_function(const void* address) {
+    if (!sort_functions() || nameof_functions_first() == nullptr || nameof_functions_last() == nullptr)
+        return nullptr;
+    const function_entry key { address, nullptr, nullptr, 0 };
+    const auto found = std::upper_bound(nameof_functions_first(), nameof_functions_last(), key, less_address);
+    return found == nameof_functions_first() || found[-1].name == nullptr || found[-1].address == nullptr ? nullptr : found - 1;
+}
+} // namespace detail
+
+/// Loads sizes of registered functions once, so name_of_code_address matches any address within a function,
+/// returns false if sizes are not available, e.g. the object file is stripped or the platform is not supported
+inline bool load_function_sizes() {
+    const auto first = detail::nameof_functions_first(), last = detail::nameof_functions_last();
+    if (!detail::sort_functions() || first == nullptr || last == nullptr)
+        return false;
+#if NAMEOF_FUNCTION_SIZES
+    detail::sort_section_once(detail::function_sizes_state, [first, last] {
+        detail::resolve_function_sizes(first, last);
+    });
+#endif
+    return std::any_of(first, last, [](const detail::function_entry& entry) { return entry.size != 0; });
+}
+
+/// Returns fully qualified name of the registered function at address, empty name if there is none
+inline name_type name_of_address(const void* address) {
+    const auto entry = detail::find_function(address);
+    return entry && entry->address == address ? *entry->name : name_type{};
+}
+
+/// Returns fully qualified name of the registered function containing address, empty name if there is none,
+/// suits return addresses and sampled program counters
+inline name_type name_of_code_address(const void* address) {
+    const auto entry = detail::find_function(address);
+    if (entry == nullptr)
+        return {};
+    const auto offset = reinterpret_cast<std::uintptr_t>(address) - reinterpret_cast<std::uintptr_t>(entry->address);
+    return offset == 0 || offset < entry->size ? *entry->name : name_type{};
+}
+
+/// Returns number of registered functions, including duplicates and virtual member functions, which have no address
+inline std::size_t registered_functions_count() {
+    const auto first = detail::nameof_functions_first(), last = detail::nameof_functions_last();
+    return first && last ? static_cast<std::size_t>(last - first) : 0;
+}
+} // namespace meta
+
+/// Registers a function or a non-virtual member function for name_of_address, used at namespace scope
+#define NAMEOF_REGISTER_FUNCTION(...) \
+    NAMEOF_IN_SECTION(nameof_functions, ::meta::detail::function_entry) \
+    static ::meta::detail::function_entry NAMEOF_CONCAT(nameof_function_, __COUNTER__) { \
+        nullptr, &::meta::detail::function_address<__VA_ARGS__>, &::meta::detail::function_name<__VA_ARGS__>, 0 }
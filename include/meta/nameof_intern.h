@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_intern.h - 32-bit name identifiers and dictionaries for binary logs
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <vector>
+
+/*
+ * Interned names: a name_id is a 32-bit fold of type_hash of the canonical name, stable across builds and compilers
+ * name_dictionary<Ts...> lists names of types Ts and of enumerators of enums among Ts, checks them for collisions
+ * and provides a compile-time binary image of the id to name dictionary, to be written once per log
+ * Image layout, integers are little endian:
+ *   "NMID" u32:count { u32:id u16:size char[size] }...
+ */
+
+namespace meta {
+using name_id = std::uint32_t;
+
+namespace detail {
+constexpr name_id fold_name_id(std::uint64_t hash) {
+    const auto id = static_cast<name_id>(hash ^ (hash >> 32));
+    return id == 0 ? 1 : id; // 0 stands for unknown names
+}
+
+template <typename T>
+inline constexpr name_id type_name_id = fold_name_id(type_hash_value<T>);
+
+template <auto V>
+inline constexpr name_id value_name_id = fold_name_id(fnv1a(canonical_nameof<V>()));
+
+template <typename E, std::size_t ... I>
+constexpr std::array<name_id, sizeof...(I)> make_enum_name_ids(std::index_sequence<I...>) {
+    return {{ value_name_id<enum_table<E>::values[I]>... }};
+}
+
+template <typename E>
+inline constexpr auto enum_name_ids = make_enum_name_ids<E>(std::make_index_sequence<enum_table<E>::count()>{});
+
+struct name_entry {
+    name_id id;
+    name_type name;
+};
+
+template <typename E, std::size_t ... I>
+constexpr std::array<name_entry, sizeof...(I) + 1> make_enum_entries(std::index_sequence<I...>) {
+    return {{ { type_name_id<E>, canonical_nameof<E>() },
+              { value_name_id<enum_table<E>::values[I]>, canonical_nameof<enum_table<E>::values[I]>() }... }};
+}
+
+/// Name of T and names of enumerators of T if T is an enum
+template <typename T>
+constexpr auto name_entries() {
+    if constexpr (std::is_enum_v<T>)
+        return make_enum_entries<T>(std::make_index_sequence<enum_table<T>::count()>{});
+    else
+        return std::array<name_entry, 1>{{ { type_name_id<T>, canonical_nameof<T>() } }};
+}
+
+/// Sorts entries by id with four counting passes, one per byte of the id, which is linear in N
+template <std::size_t N>
+constexpr std::array<name_entry, N> sort_by_id(const std::array<name_entry, N>& entries) {
+    std::array<name_entry, N> buffers[2] { entries, {} };
+    for(unsigned pass = 0; pass < 4; ++pass) {
+        const auto& from = buffers[pass % 2];
+        auto& to = buffers[(pass + 1) % 2];
+        const auto digit = [pass](name_id id) { return static_cast<std::size_t>((id >> (pass * 8)) & 0xFFu); };
+        std::array<std::size_t, 257> offsets {};
+        for(const auto& entry : from)
+            ++offsets[digit(entry.id) + 1];
+        for(std::size_t i = 1; i < offsets.size(); ++i)
+            offsets[i] += offsets[i - 1];
+        for(const auto& entry : from)
+            to[offsets[digit(entry.id)]++] = entry;
+    }
+    return buffers[0];
+}
+
+template <typename ... Ts>
+constexpr auto make_name_entries() {
+    constexpr std::size_t count = (name_entries<Ts>().size() + ... + 0);
+    std::array<name_entry, count> result {};
+    std::size_t n = 0;
+    ((void) [&result, &n] { for(const auto& entry : name_entries<Ts>()) result[n++] = entry; }(), ...);
+    return sort_by_id(result);
+}
+
+template <std::size_t N>
+constexpr bool unique_name_ids(const std::array<name_entry, N>& entries) {
+    for(std::size_t i = 1; i < N; ++i)
+        if (entries[i].id == entries[i - 1].id)
+            return false;
+    return true;
+}
+
+constexpr char* put_integer(char* out, std::uint32_t value, std::size_t size) {
+    for(std::size_t i = 0; i < size; ++i, value >>= 8)
+        *out++ = static_cast<char>(value & 0xFFu);
+    return out;
+}
+
+constexpr std::uint32_t get_integer(const char* in, std::size_t size) {
+    std::uint32_t value = 0;
+    for(std::size_t i = size; i > 0; --i)
+        value = (value << 8) | static_cast<unsigned char>(in[i - 1]);
+    return value;
+}
+
+inline constexpr name_type name_image_magic = "NMID";
+inline constexpr std::size_t name_image_header = 8;
+inline constexpr std::size_t name_image_entry = 6;
+inline constexpr std::size_t name_image_max_size = 0xFFFF; // u16:size
+
+template <std::size_t N>
+constexpr bool names_fit_image(const std::array<name_entry, N>& entries) {
+    for(const auto& entry : entries)
+        if (entry.name.size() > name_image_max_size)
+            return false;
+    return true;
+}
+} // namespace detail
+
+/// Returns name_id of the canonical name of T
+template <typename T>
+constexpr name_id name_id_of() noexcept {
+    return detail::type_name_id<T>;
+}
+
+/// Returns name_id of the canonical name of V
+template <auto V>
+constexpr name_id name_id_of() noexcept {
+    return detail::value_name_id<V>;
+}
+
+/// Returns name_id of enumerator value or 0 if value is not an enumerator within enum_range<E>
+template <typename E>
+constexpr name_id enum_name_id(E value) noexcept {
+    static_assert(std::is_enum_v<E>, "E is not an enum");
+    const auto index = detail::enum_table<E>::find(value);
+    return index < detail::enum_table<E>::count() ? detail::enum_name_ids<E>[index] : 0;
+}
+
+/// Compile-time dictionary of names of Ts and enumerators of enums among Ts
+template <typename ... Ts>
+struct name_dictionary {
+    static constexpr auto entries = detail::make_name_entries<Ts...>();
+    static_assert(detail::unique_name_ids(entries), "Ts contain duplicates or names with colliding name ids");
+    static_assert(detail::names_fit_image(entries), "Ts contain names longer than 65535 characters");
+
+    static constexpr std::size_t image_size() {
+        std::size_t result = detail::name_image_header;
+        for(const auto& entry : entries)
+            result += detail::name_image_entry + entry.name.size();
+        return result;
+    }
+
+    static constexpr std::array<char, image_size()> make_image() {
+        std::array<char, image_size()> result {};
+        auto out = result.data();
+        for(const auto c : detail::name_image_magic)
+            *out++ = c;
+        out = detail::put_integer(out, static_cast<std::uint32_t>(entries.size()), 4);
+        for(const auto& entry : entries) {
+            out = detail::put_integer(out, entry.id, 4);
+            out = detail::put_integer(out, static_cast<std::uint32_t>(entry.name.size()), 2);
+            for(const auto c : entry.name)
+                *out++ = c;
+        }
+        return result;
+    }
+
+    /// Binary image of the dictionary
+    static constexpr auto image = make_image();
+
+    /// Returns name of id or an empty name if id is not in the dictionary
+    static constexpr name_type find(name_id id) noexcept {
+        std::size_t lo = 0, hi = entries.size();
+        while(lo < hi) {
+            const auto mid = lo + (hi - lo) / 2;
+            if (entries[mid].id < id) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo < entries.size() && entries[lo].id == id ? entries[lo].name : name_type{};
+    }
+};
+
+/// Reference decoder of dictionary images, names refer to the image, which must outlive the decoder
+class name_decoder {
+public:
+    /// Loads dictionary image, returns false and leaves the decoder empty if the image is malformed
+    bool load(name_type image) {
+        entries_.clear();
+        if (! parse(image)) {
+            entries_.clear();
+            return false;
+        }
+        std::sort(entries_.begin(), entries_.end(), [](const auto& a, const auto& b) { return a.id < b.id; });
+        return true;
+    }
+
+    /// Returns name of id or an empty name if id is not in the loaded dictionary
+    name_type operator()(name_id id) const {
+        const auto found = std::lower_bound(entries_.begin(), entries_.end(), id,
+            [](const detail::name_entry& entry, name_id key) { return entry.id < key; });
+        return found != entries_.end() && found->id == id ? found->name : name_type{};
+    }
+
+    std::size_t size() const noexcept { return entries_.size(); }
+private:
+    bool parse(name_type image) {
+        if (image.size() < detail::name_image_header || image.substr(0, 4) != detail::name_image_magic)
+            return false;
+        const auto count = detail::get_integer(image.data() + 4, 4);
+        std::size_t pos = detail::name_image_header;
+        for(std::uint32_t i = 0; i < count; ++i) {
+            if (image.size() - pos < detail::name_image_entry)
+                return false;
+            const auto id = detail::get_integer(image.data() + pos, 4);
+            const auto size = detail::get_integer(image.data() + pos + 4, 2);
+            pos += detail::name_image_entry;
+            if (image.size() - pos < size)
+                return false;
+            entries_.push_back({ id, image.substr(pos, size) });
+            pos += size;
+        }
+        return true;
+    }
+
+    std::vector<detail::name_entry> entries_ {};
+};
+} // namespace meta
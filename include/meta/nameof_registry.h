@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_registry.h - registry of exported type names, enumerable without static initializers
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <meta/nameof.h>
+#include <meta/nameof_section.h>
+#include <algorithm>
+
+/*
+ * NAMEOF_EXPORT(Type) places a constant record { name, size, hash } of the canonical name of Type
+ * into section nameof_names, gathered by the linker, so there are no static initializers
+ * A type may be exported by any number of translation units, the records are sorted in place by hash once,
+ * by the first enumeration, and duplicates are moved past the end of the registry,
+ * so enumeration is a linear scan over contiguous memory, enumerations made while the records are being sorted
+ * see an empty registry
+ * Each executable or shared object has a registry of its own types
+ * Supported with GCC and Clang on ELF targets and with MSVC, elsewhere the registry is empty
+ */
+
+namespace meta {
+struct name_record {
+    const char* name;
+    std::size_t size;
+    std::uint64_t hash;
+
+    constexpr name_type view() const noexcept { return { name, size }; }
+};
+
+namespace detail {
+template <typename T>
+constexpr name_record make_name_record() {
+    return { canonical_type_name<T>.data(), canonical_type_name<T>.size(), type_hash_value<T> };
+}
+} // namespace detail
+} // namespace meta
+
+NAMEOF_SECTION(nameof_names, ::meta::name_record)
+
+namespace meta {
+namespace detail {
+inline std::atomic<section_state> names_state { section_state::unsorted };
+inline name_record* unique_names_end = nullptr;
+
+inline bool less_name_record(const name_record& lhs, const name_record& rhs) {
+    // msvc may pad the section with zeros, empty records go last
+    if ((lhs.name == nullptr) != (rhs.name == nullptr))
+        return rhs.name == nullptr;
+    return lhs.hash < rhs.hash || (lhs.hash == rhs.hash && lhs.view() < rhs.view());
+}
+
+inline bool same_name_record(const name_record& lhs, const name_record& rhs) {
+    return lhs.hash == rhs.hash && lhs.view() == rhs.view();
+}
+
+/// Sorts records and moves duplicates past unique_names_end on first call, returns false while another call is sorting
+inline bool sort_names() {
+    return sort_section_once(names_state, [] {
+        const auto first = nameof_names_first(), last = nameof_names_last();
+        if (first == nullptr || last == nullptr)
+            return;
+        std::sort(first, last, less_name_record);
+        unique_names_end = std::unique(first,
+            std::find_if(first, last, [](const name_record& r) { return r.name == nullptr; }), same_name_record);
+    });
+}
+
+/// Returns end of unique records, nullptr if there are none or while they are being sorted
+inline name_record* unique_name_records() {
+    return sort_names() ? unique_names_end : nullptr;
+}
+} // namespace detail
+
+/// Calls f(record) for each type exported from this executable or shared object, once per type, ordered by hash
+template <typename F>
+void for_each_exported_name(F&& f) {
+    const auto end = detail::unique_name_records();
+    if (end == nullptr)
+        return;
+    for(auto record = detail::nameof_names_first(); record != end; ++record)
+        f(static_cast<const name_record&>(*record));
+}
+
+/// Returns number of types exported from this executable or shared object
+inline std::size_t exported_names_count() {
+    const auto end = detail::unique_name_records();
+    return end ? static_cast<std::size_t>(end - detail::nameof_names_first()) : 0;
+}
+
+/// Returns record of the exported type with the given type hash or nullptr if there is none
+inline const name_record* find_exported_name(std::uint64_t hash) {
+    const auto end = detail::unique_name_records();
+    if (end == nullptr)
+        return nullptr;
+    const auto found = std::lower_bound(detail::nameof_names_first(), end, hash,
+        [](const name_record& record, std::uint64_t key) { return record.hash < key; });
+    return found != end && found->hash == hash ? found : nullptr;
+}
+} // namespace meta
+
+/// Exports the canonical name of a type into the registry, used at namespace scope
+#define NAMEOF_EXPORT(...) \
+    NAMEOF_IN_SECTION(nameof_names, ::meta::name_record) \
+    static ::meta::name_record NAMEOF_CONCAT(nameof_exported_, __COUNTER__) = \
+        ::meta::detail::make_name_record<__VA_ARGS__>()
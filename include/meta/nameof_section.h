@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_section.h - arrays of constant records gathered by the linker into a named section
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <atomic>
+
+/*
+ * NAMEOF_SECTION(section, Type) declares meta::detail::section_first() and section_last(), bounds of the array
+ * of Type records placed into the section with NAMEOF_IN_SECTION(section, Type) by all translation units
+ * of an executable or shared object, so the array needs no static initializers
+ * MSVC may pad the array with zero-initialized records
+ * Supported with GCC and Clang on ELF targets and with MSVC, elsewhere the bounds are nullptr
+ */
+
+#define NAMEOF_CONCAT_(a, b) a##b
+#define NAMEOF_CONCAT(a, b) NAMEOF_CONCAT_(a, b)
+#define NAMEOF_STRINGIZE_(a) #a
+#define NAMEOF_STRINGIZE(a) NAMEOF_STRINGIZE_(a)
+
+#if defined(_MSC_VER)
+// records are placed in Section$m, which the linker puts between Section$a and Section$z
+#define NAMEOF_SECTION(Section, Type) \
+    __pragma(section(NAMEOF_STRINGIZE(Section##$a), read, write)) \
+    __pragma(section(NAMEOF_STRINGIZE(Section##$m), read, write)) \
+    __pragma(section(NAMEOF_STRINGIZE(Section##$z), read, write)) \
+    namespace meta::detail { \
+    __declspec(allocate(NAMEOF_STRINGIZE(Section##$a))) inline Type Section##_begin[1] {}; \
+    __declspec(allocate(NAMEOF_STRINGIZE(Section##$z))) inline Type Section##_end[1] {}; \
+    inline Type* Section##_first() { return Section##_begin + 1; } \
+    inline Type* Section##_last() { return Section##_end; } \
+    }
+#define NAMEOF_IN_SECTION(Section, Type) __declspec(allocate(NAMEOF_STRINGIZE(Section##$m)))
+#elif defined(__ELF__)
+// the linker defines __start_ and __stop_ symbols for sections named as C identifiers
+#define NAMEOF_SECTION(Section, Type) \
+    extern "C" { \
+    extern Type __start_##Section[] __attribute__((weak, visibility("hidden"))); \
+    extern Type __stop_##Section[] __attribute__((weak, visibility("hidden"))); \
+    } \
+    namespace meta::detail { \
+    inline Type* Section##_first() { return __start_##Section; } \
+    inline Type* Section##_last() { return __stop_##Section; } \
+    }
+#define NAMEOF_IN_SECTION(Section, Type) __attribute__((used, section(#Section), aligned(alignof(Type))))
+#else
+#define NAMEOF_SECTION(Section, Type) \
+    namespace meta::detail { \
+    inline Type* Section##_first() { return nullptr; } \
+    inline Type* Section##_last() { return nullptr; } \
+    }
+#define NAMEOF_IN_SECTION(Section, Type) [[maybe_unused]]
+#endif
+
+namespace meta::detail {
+enum class section_state { unsorted, sorting, sorted };
+
+/// Calls sort once per state, returns false while another call is sorting
+/// Sections are sorted by initializers of inline variables at load time, so lookups from other threads
+/// or signal handlers do not race with the sort, unless they are made from other static initializers
+template <typename F>
+bool sort_section_once(std::atomic<section_state>& state, F&& sort) {
+    auto current = state.load(std::memory_order_acquire);
+    if (current == section_state::sorted)
+        return true;
+    if (current == section_state::sorting ||
+        !state.compare_exchange_strong(current, section_state::sorting, std::memory_order_acquire))
+        return current == section_state::sorted;
+    sort();
+    state.store(section_state::sorted, std::memory_order_release);
+    return true;
+}
+} // namespace meta::detail
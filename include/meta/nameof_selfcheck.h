@@ -36,6 +36,28 @@ static_assert(nameof<&function>() == "function");
 static_assert(nameof<Enum::value>() == "value");
 static_assert(nameof<&tough>() == "tough");
 
+static_assert(static_fully_qualified_nameof<Class>() == "meta::nameof_selfcheck::Class");
+static_assert(static_fully_qualified_nameof<Enum::value>() == "meta::nameof_selfcheck::Enum::value");
+static_assert(static_nameof<&Class::method>() == "method");
+static_assert(static_nameof<Enum::value>() == "value");
+
+static_assert(enum_name(Enum::value) == "value");
+static_assert(enum_name(static_cast<Enum>(1)).empty());
+static_assert(is_enumerator<Enum::value>());
+static_assert(! is_enumerator<static_cast<Enum>(1)>());
+static_assert(enum_cast<Enum>("value") == Enum::value);
+static_assert(! enum_cast<Enum>("Value"));
+static_assert(enum_cast<Enum, enum_cast_flags::ignore_case>("Value") == Enum::value);
+
+static_assert(canonical_nameof<Class>() == "meta::nameof_selfcheck::Class");
+static_assert(canonical_nameof<&Class::method>() == "meta::nameof_selfcheck::Class::method");
+static_assert(canonical_nameof<std::string_view>() == "std::basic_string_view<char>");
+static_assert(type_hash<Class>() == detail::fnv1a("meta::nameof_selfcheck::Class"));
+static_assert(unique_type_hashes<type_list<Class, Enum>>());
+static_assert(type_index_of<Enum, type_list<Class, Enum>> == 1);
+static_assert(names_of<type_list<Class, Enum>>()[1] == "meta::nameof_selfcheck::Enum");
+static_assert(fixed_string{"Enum"} == nameof<Enum>());
+
 }
 
  // namespace meta::nameof_selfcheck
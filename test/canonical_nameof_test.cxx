@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * canonical_nameof_test.cpp - Unit test for canonical_nameof and canonicalize
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <unordered_set>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+using namespace NameSpace;
+
+namespace {
+struct Anonymous {};
+using IntLongMap = std::map<int, long>;
+
+template <typename T>
+struct Allocator : std::allocator<T> {};
+
+struct Other {};
+
+using SetLessVoid = std::set<int, std::less<>>;
+using VectorCustomAllocator = std::vector<int, Allocator<int>>;
+using UnorderedSetHashOther = std::unordered_set<int, std::hash<Other>>;
+using UnorderedSetDefault = std::unordered_set<int, std::hash<int>, std::equal_to<int>>;
+using MapCustomAllocator = std::map<int, long, std::less<int>, Allocator<std::pair<const int, long>>>;
+}
+
+template <>
+struct std::hash<Other> {
+    std::size_t operator()(int) const { return 0; }
+};
+
+#define TESTCASE(NAME, INPUT, EXPECTED) TEST(NameOf, NAME) { EXPECT_EQ(canonical_nameof<INPUT>(), EXPECTED) << meta::detail::name<INPUT>(); }
+
+TESTCASE(CanonicalEnum,             test_enum::test_zero, "test_enum::test_zero")
+TESTCASE(CanonicalVariable,         &variable, "variable")
+TESTCASE(CanonicalConstant,         constant, "1")
+TESTCASE(CanonicalResult,           *function(), "1")
+TESTCASE(CanonicalStringView,       std::string_view, "std::basic_string_view<char>")
+TESTCASE(CanonicalString,           std::string, "std::basic_string<char>")
+TESTCASE(CanonicalVector,           std::vector<std::string>, "std::vector<std::basic_string<char>>")
+TESTCASE(CanonicalMap,              IntLongMap,             "std::map<int,long>")
+TESTCASE(CanonicalUniquePtr,        std::unique_ptr<Class>, "std::unique_ptr<NameSpace::Class>")
+TESTCASE(CanonicalClassName,        Class, "NameSpace::Class")
+TESTCASE(CanonicalTemplate,         Class::Template<wchar_t>, "NameSpace::Class::Template<wchar_t>")
+TESTCASE(CanonicalTemplateMethod,   &Class::Template<wchar_t>::method, "NameSpace::Class::Template<wchar_t>::method")
+TESTCASE(CanonicalAnonymous,        Anonymous, "(anonymous namespace)::Anonymous")
+TESTCASE(CanonicalPointer,          const char*, "const char*")
+TESTCASE(CanonicalLessVoid,         SetLessVoid, "std::set<int,std::less<void>>")
+TESTCASE(CanonicalCustomAllocator,  VectorCustomAllocator, "std::vector<int,(anonymous namespace)::Allocator<int>>")
+TESTCASE(CanonicalHashOther,        UnorderedSetHashOther,
+    "std::unordered_set<int,std::hash<(anonymous namespace)::Other>>")
+TESTCASE(CanonicalUnorderedDefault, UnorderedSetDefault, "std::unordered_set<int>")
+TESTCASE(CanonicalKeepsLess,        MapCustomAllocator,
+    "std::map<int,long,std::less<int>,(anonymous namespace)::Allocator<std::pair<const int,long>>>")
+
+struct CanonicalItem {
+    std::string_view expected;
+    std::string_view input;
+};
+
+constexpr std::array<CanonicalItem, 20> canonical_items = {
+    CanonicalItem{ "std::basic_string_view<char>"sv,      "std::basic_string_view<char>"sv },
+    CanonicalItem{ "std::basic_string_view<char>"sv,      "std::basic_string_view<char,struct std::char_traits<char> >"sv },
+    CanonicalItem{ "std::basic_string_view<char>"sv,      "std::basic_string_view<char, std::char_traits<char>>"sv },
+    CanonicalItem{ "std::basic_string_view<char>"sv,      "std::basic_string_view<char, std::char_traits<char> >"sv },
+    CanonicalItem{ "std::basic_string<char>"sv,           "std::__cxx11::basic_string<char>"sv },
+    CanonicalItem{ "std::basic_string<char>"sv,           "std::__1::basic_string<char, std::__1::char_traits<char>, std::__1::allocator<char> >"sv },
+    CanonicalItem{ "std::basic_string<char>"sv,           "class std::basic_string<char,struct std::char_traits<char>,class std::allocator<char> >"sv },
+    CanonicalItem{ "A<1,-2,4294967295>"sv,                "A<1L, -2, 0xffffffffU>"sv },
+    CanonicalItem{ "A<unsigned long long>"sv,             "struct A<unsigned __int64>"sv },
+    CanonicalItem{ "A<unsigned short,long>"sv,            "A<short unsigned int, long int>"sv },
+    CanonicalItem{ "A<unsigned long long,long long>"sv,   "A<long long unsigned int, long long int>"sv },
+    CanonicalItem{ "A<long double,signed char,int>"sv,    "A<long double, signed char, signed>"sv },
+    CanonicalItem{ "A<const unsigned int*>"sv,            "A<const unsigned *>"sv },
+    CanonicalItem{ "(anonymous namespace)::A"sv,          "`anonymous namespace'::A"sv },
+    CanonicalItem{ "(anonymous namespace)::A"sv,          "{anonymous}::A"sv },
+    CanonicalItem{ "std::map<int,A<B>>"sv,                "class std::map<int,struct A<enum B>,struct std::less<int>,class std::allocator<struct std::pair<int const ,struct A<enum B> > > >"sv },
+    CanonicalItem{ "std::map<int,A<B>>"sv,                "std::map<int, A<B>, std::less<int>, std::allocator<std::pair<const int, A<B> > > >"sv },
+    CanonicalItem{ "std::set<int,std::less<long>>"sv,     "std::set<int, std::less<long>, std::allocator<int> >"sv },
+    CanonicalItem{ "std::set<int,std::less<void>>"sv,     "class std::set<int,struct std::less<void>,class std::allocator<int> >"sv },
+    CanonicalItem{ "std::map<int,long,std::less<int>,std::allocator<std::pair<const int,int>>>"sv,
+                   "std::map<int, long, std::less<int>, std::allocator<std::pair<const int, int> > >"sv },
+};
+
+TEST(NameOf, Canonicalize) {
+    for(const auto i : canonical_items) {
+        RecordProperty("Input"s, std::string{i.input});
+        EXPECT_EQ(canonical(i.input), i.expected);
+    }
+}
+
+TEST(NameOf, CanonicalTypeHash) {
+    EXPECT_EQ(type_hash<std::string_view>(), detail::fnv1a("std::basic_string_view<char>"));
+    EXPECT_EQ(type_hash<std::string>(), detail::fnv1a("std::basic_string<char>"));
+    EXPECT_NE(type_hash<std::set<int>>(), type_hash<SetLessVoid>());
+    EXPECT_NE(type_hash<std::vector<int>>(), type_hash<VectorCustomAllocator>());
+    EXPECT_NE(type_hash<std::unordered_set<int>>(), type_hash<UnorderedSetHashOther>());
+    EXPECT_EQ(type_hash<std::unordered_set<int>>(), type_hash<UnorderedSetDefault>());
+}
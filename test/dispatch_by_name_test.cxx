@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * dispatch_by_name_test.cpp - Unit test for dispatch_by_name
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include <string>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace rpc {
+struct Order { static constexpr int id = 1; };
+struct Cancel { static constexpr int id = 2; };
+template <typename T>
+struct Batch { static constexpr int id = 10 + T::id; };
+}
+
+namespace {
+using Messages = type_list<rpc::Order, rpc::Cancel, rpc::Batch<rpc::Order>, rpc::Batch<rpc::Cancel>>;
+
+struct message_id {
+    template <typename T>
+    int operator()() const { return T::id; }
+};
+
+struct message_name {
+    std::string& name;
+    template <typename T>
+    void operator()() const { name = std::string{nameof<T>()}; }
+};
+}
+
+#define TESTCASE(NAME, INPUT, EXPECTED) TEST(NameOf, NAME) { \
+    EXPECT_EQ(dispatch_by_name<Messages>(INPUT, message_id{}), EXPECTED); }
+
+TESTCASE(DispatchFirst,       "rpc::Order", 1)
+TESTCASE(DispatchSecond,      "rpc::Cancel", 2)
+TESTCASE(DispatchTemplate,    fully_qualified_nameof<rpc::Batch<rpc::Cancel>>(), 12)
+TESTCASE(DispatchUnknown,     "rpc::Replace", std::nullopt)
+TESTCASE(DispatchUnqualified, "Order", std::nullopt)
+TESTCASE(DispatchEmpty,       "", std::nullopt)
+
+TEST(NameOf, DispatchVoid) {
+    std::string name;
+    EXPECT_TRUE(dispatch_by_name<Messages>("rpc::Cancel", message_name{name}));
+    EXPECT_EQ(name, "Cancel");
+    EXPECT_FALSE(dispatch_by_name<Messages>("rpc::cancel", message_name{name}));
+    EXPECT_EQ(name, "Cancel");
+}
+
+TEST(NameOf, DispatchAllTypes) {
+    for(const auto name : names_of<Messages>())
+        EXPECT_TRUE(dispatch_by_name<Messages>(name, message_id{}).has_value()) << name;
+}
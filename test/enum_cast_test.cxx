@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * enum_cast_test.cpp - Unit test for enum_cast
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+enum class Side { buy, sell, sell_short };
+enum class Venue : short { venue_XNYS = 1, venue_XNAS = 4, venue_BATS = 17, venue_ARCX = 100, other = -3 };
+}
+
+template <>
+struct meta::enum_prefix<Venue> {
+    static constexpr name_type value = "venue_";
+};
+
+static_assert(enum_cast<Side>("sell") == Side::sell);
+static_assert(! enum_cast<Side>("Sell"));
+static_assert(enum_cast<Side, enum_cast_flags::ignore_case>("Sell") == Side::sell);
+static_assert(enum_cast<Venue, enum_cast_flags::strip_prefix>("XNAS") == Venue::venue_XNAS);
+
+#define TESTCASE(NAME, TYPE, FLAGS, INPUT, EXPECTED) TEST(NameOf, NAME) { \
+    EXPECT_EQ((enum_cast<TYPE, enum_cast_flags::FLAGS>(INPUT)), (EXPECTED)); }
+
+TESTCASE(EnumCast,                 test_enum, none, "test_zero", test_enum::test_zero)
+TESTCASE(EnumCastSide,             Side, none, "sell_short", Side::sell_short)
+TESTCASE(EnumCastMissing,          Side, none, "short", std::nullopt)
+TESTCASE(EnumCastEmpty,            Side, none, "", std::nullopt)
+TESTCASE(EnumCastCase,             Side, none, "BUY", std::nullopt)
+TESTCASE(EnumCastIgnoreCase,       Side, ignore_case, "BUY", Side::buy)
+TESTCASE(EnumCastIgnoreCaseMixed,  Side, ignore_case, "Sell_Short", Side::sell_short)
+TESTCASE(EnumCastSparse,           Venue, none, "venue_BATS", Venue::venue_BATS)
+TESTCASE(EnumCastNegative,         Venue, none, "other", Venue::other)
+TESTCASE(EnumCastNoStrip,          Venue, none, "BATS", std::nullopt)
+TESTCASE(EnumCastStrip,            Venue, strip_prefix, "ARCX", Venue::venue_ARCX)
+TESTCASE(EnumCastStripUnprefixed,  Venue, strip_prefix, "other", Venue::other)
+TESTCASE(EnumCastStripPrefixed,    Venue, strip_prefix, "venue_ARCX", std::nullopt)
+TESTCASE(EnumCastStripIgnoreCase,  Venue, strip_prefix | enum_cast_flags::ignore_case, "xnys", Venue::venue_XNYS)
+
+TEST(NameOf, EnumCastRoundTrip) {
+    for(const auto value : enum_values<Venue>())
+        EXPECT_EQ(enum_cast<Venue>(enum_name(value)), value);
+}
+
+TEST(NameOf, PerfectHash) {
+    constexpr std::array<name_type, 6> keys = { "a"sv, "b"sv, "ab"sv, "ba"sv, ""sv, "abc"sv };
+    constexpr auto hash = detail::make_perfect_hash<false>(keys);
+    static_assert(hash.valid);
+    for(std::size_t i = 0; i < keys.size(); ++i)
+        EXPECT_EQ(detail::find<false>(hash, keys, keys[i]), i);
+    EXPECT_EQ(detail::find<false>(hash, keys, "c"), keys.size());
+    constexpr std::array<name_type, 2> same = { "Key"sv, "kEY"sv };
+    static_assert(! detail::make_perfect_hash<true>(same).valid);
+}
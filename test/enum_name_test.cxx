@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * enum_name_test.cpp - Unit test for enum_name
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+enum class Dense { zero, one, two, three };
+enum class Holes : unsigned char { one = 1, three = 3, four, five };
+enum class Sparse : short { minus = -100, zero = 0, ten = 10, hundred = 100 };
+enum Unscoped : int { alpha = -1, beta, gamma };
+enum Small { small_a, small_b, small_c };
+enum class Wide : long long { small = -5, big = 120, huge = 2000 };
+enum class Signed : long long { minus = -2, zero, one };
+enum class Unsigned : unsigned long long { zero, two = 2, three };
+}
+
+template <>
+struct meta::enum_range<Wide> {
+    static constexpr int min = -10;
+    static constexpr int max = 2000;
+};
+
+static_assert(detail::enum_table<Dense>::contiguous);
+static_assert(detail::enum_table<Holes>::indexed);
+static_assert(detail::enum_table<Sparse>::indexed);
+static_assert(detail::enum_table<Signed>::contiguous);
+static_assert(detail::enum_table<Unsigned>::indexed);
+static_assert(! detail::has_fixed_underlying_type<Small>::value);
+static_assert(detail::enum_table<Small>::count() == 3);
+static_assert(! detail::enum_table<Wide>::indexed && ! detail::enum_table<Wide>::contiguous);
+static_assert(enum_name(Dense::two) == "two");
+static_assert(enum_name(Sparse::hundred) == "hundred");
+static_assert(enum_name<Sparse::ten>() == "ten");
+static_assert(is_enumerator<Holes::four>());
+static_assert(! is_enumerator<static_cast<Holes>(2)>());
+
+#define TESTCASE(NAME, INPUT, EXPECTED) TEST(NameOf, NAME) { EXPECT_EQ(enum_name(INPUT), EXPECTED) << meta::detail::name<INPUT>(); }
+
+TESTCASE(EnumName,              test_enum::test_zero, "test_zero")
+TESTCASE(EnumNameDense,         Dense::three, "three")
+TESTCASE(EnumNameDenseFirst,    Dense::zero, "zero")
+TESTCASE(EnumNameHoles,         Holes::one, "one")
+TESTCASE(EnumNameHolesLast,     Holes::five, "five")
+TESTCASE(EnumNameHole,          static_cast<Holes>(2), "")
+TESTCASE(EnumNameHolesOutside,  static_cast<Holes>(200), "")
+TESTCASE(EnumNameSparseMin,     Sparse::minus, "minus")
+TESTCASE(EnumNameSparseMid,     Sparse::ten, "ten")
+TESTCASE(EnumNameSparseMax,     Sparse::hundred, "hundred")
+TESTCASE(EnumNameSparseMissing, static_cast<Sparse>(11), "")
+TESTCASE(EnumNameSparseOutside, static_cast<Sparse>(1000), "")
+TESTCASE(EnumNameUnscoped,      alpha, "alpha")
+TESTCASE(EnumNameUnscopedLast,  gamma, "gamma")
+TESTCASE(EnumNameSmall,         small_b, "small_b")
+TESTCASE(EnumNameSmallMissing,  static_cast<Small>(3), "")
+TESTCASE(EnumNameWide,          Wide::big, "big")
+TESTCASE(EnumNameWideHuge,      Wide::huge, "huge")
+TESTCASE(EnumNameWideMissing,   static_cast<Wide>(121), "")
+TESTCASE(EnumNameWideOutside,   static_cast<Wide>(1LL << 40), "")
+TESTCASE(EnumNameWideMax,       static_cast<Wide>(std::numeric_limits<long long>::max()), "")
+TESTCASE(EnumNameWideMin,       static_cast<Wide>(std::numeric_limits<long long>::min()), "")
+TESTCASE(EnumNameSignedMax,     static_cast<Signed>(std::numeric_limits<long long>::max()), "")
+TESTCASE(EnumNameSignedMin,     static_cast<Signed>(std::numeric_limits<long long>::min()), "")
+TESTCASE(EnumNameSignedFirst,   Signed::minus, "minus")
+TESTCASE(EnumNameUnsignedMax,   static_cast<Unsigned>(std::numeric_limits<unsigned long long>::max()), "")
+TESTCASE(EnumNameUnsignedLast,  Unsigned::three, "three")
+
+TEST(NameOf, EnumFullyQualifiedName) {
+    EXPECT_EQ(enum_fully_qualified_name(test_enum::test_zero), "test_enum::test_zero");
+    EXPECT_EQ(enum_fully_qualified_name(Sparse::ten), fully_qualified_nameof<Sparse::ten>());
+    EXPECT_EQ(enum_fully_qualified_name(static_cast<Holes>(2)), "");
+}
+
+TEST(NameOf, EnumValues) {
+    EXPECT_EQ(enum_values<Sparse>().size(), 4u);
+    EXPECT_EQ(enum_values<Holes>().front(), Holes::one);
+    EXPECT_EQ(enum_values<Holes>().back(), Holes::five);
+    EXPECT_TRUE(enum_contains(Unscoped::beta));
+    EXPECT_FALSE(enum_contains(static_cast<Dense>(4)));
+}
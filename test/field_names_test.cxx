@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * field_names_test.cpp - Unit test for field_names, for_each_field and member_name
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_fields.h>
+#include <cstddef>
+#include <memory>
+#include "test_inputs.h"
+
+#if __cpp_nontype_template_args >= 201911L
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+struct Empty {};
+struct Point {
+    int x;
+    int y;
+};
+struct Order {
+    long id;
+    std::string symbol;
+    double price {};
+    Point where;
+    NameSpace::Class::Inner inner;
+    bool active = true;
+};
+struct Holder {
+    std::unique_ptr<int> pointer;
+    const int value;
+};
+struct Record {
+    char flag;
+    double price;
+    short count;
+    Point where;
+    int id;
+    long long volume;
+    char tag;
+};
+struct Aligned {
+    char a;
+    alignas(2) char b;
+    char c;
+    int d;
+};
+struct Tag {};
+struct Mark {};
+struct Tagged {
+    int value;
+    [[no_unique_address]] Tag tag;
+    char flag;
+};
+struct Marked {
+    [[no_unique_address]] Tag tag;
+    [[no_unique_address]] Mark mark;
+    int value;
+};
+}
+
+static_assert(field_count<Empty>() == 0);
+static_assert(field_count<Point>() == 2);
+static_assert(field_count<Order>() == 6);
+static_assert(field_names<Point>()[1] == "y");
+
+TEST(NameOf, FieldNames) {
+    EXPECT_EQ(field_names<Order>(), (std::array{ "id"sv, "symbol"sv, "price"sv, "where"sv, "inner"sv, "active"sv }));
+    EXPECT_EQ(field_names<Holder>(), (std::array{ "pointer"sv, "value"sv }));
+    EXPECT_EQ(field_names<NameSpace::Class::Inner>(), (std::array{ "member"sv, "methodptr"sv }));
+    EXPECT_TRUE(field_names<Empty>().empty());
+}
+
+TEST(NameOf, FieldNamesAreStatic) {
+    EXPECT_EQ(field_names<Point>()[0].data()[1], '\0');
+    EXPECT_EQ(field_names<Point>()[0].data(), field_names<const Point>()[0].data());
+}
+
+TEST(NameOf, ForEachField) {
+    Order order { 42, "XYZ", 1.5, { 3, 4 }, {}, false };
+    std::string names;
+    for_each_field(order, [&](std::string_view name, auto& field) {
+        names.append(name).append(1, ';');
+        if constexpr (std::is_same_v<std::decay_t<decltype(field)>, long>)
+            field = 7;
+    });
+    EXPECT_EQ(names, "id;symbol;price;where;inner;active;");
+    EXPECT_EQ(order.id, 7);
+
+    const Point point { 1, 2 };
+    int sum = 0;
+    for_each_field(point, [&](std::string_view, const int& field) { sum += field; });
+    EXPECT_EQ(sum, 3);
+    EXPECT_EQ(std::get<1>(tie_fields(point)), 2);
+}
+
+static_assert(member_name_at_offset<Point>(sizeof(int)) == "y");
+
+TEST(NameOf, MemberNameAtOffset) {
+    EXPECT_EQ(detail::field_offsets<Record>.offsets, (std::array<std::size_t, 7>{ offsetof(Record, flag), offsetof(Record, price),
+        offsetof(Record, count), offsetof(Record, where), offsetof(Record, id), offsetof(Record, volume), offsetof(Record, tag) }));
+    EXPECT_EQ(member_name_at_offset<Record>(offsetof(Record, id)), "id");
+    EXPECT_EQ(member_name_at_offset<Record>(0), "flag");
+    EXPECT_EQ(member_name_at_offset<Record>(1), "");
+    EXPECT_EQ(member_name_at_offset<Record>(offsetof(Record, price) + 7), "price");
+    EXPECT_EQ(member_name_at_offset<Record>(offsetof(Record, where) + sizeof(int)), "where");
+    EXPECT_EQ(member_name_at_offset<const Record>(offsetof(Record, tag)), "tag");
+    EXPECT_EQ(member_name_at_offset<Record>(sizeof(Record) - 1), "");
+    EXPECT_EQ(member_name_at_offset<Record>(sizeof(Record) + 100), "");
+}
+
+TEST(NameOf, MemberName) {
+    const std::array<int Record::*, 2> members { &Record::id, nullptr };
+    EXPECT_EQ(member_name(members[0]), "id");
+    EXPECT_EQ(member_name(members[1]), "");
+    EXPECT_EQ(member_name(&Record::volume), "volume");
+    EXPECT_EQ(member_name(&Point::y), "y");
+}
+
+TEST(NameOf, MemberNameAligned) {
+    static_assert(sizeof(Aligned) == 8);
+    EXPECT_EQ(member_name(&Aligned::b), "b");
+    EXPECT_EQ(member_name(&Aligned::c), "c");
+    EXPECT_EQ(member_name_at_offset<Aligned>(1), "");
+    EXPECT_EQ(member_name_at_offset<Aligned>(offsetof(Aligned, b)), "b");
+    EXPECT_EQ(member_name_at_offset<Aligned>(offsetof(Aligned, c)), "c");
+    EXPECT_EQ(member_name_at_offset<Aligned>(offsetof(Aligned, d) + 3), "d");
+}
+
+TEST(NameOf, MemberNameNoUniqueAddress) {
+    EXPECT_EQ(member_name(&Tagged::value), "value");
+    EXPECT_EQ(member_name(&Tagged::tag), "tag");
+    EXPECT_EQ(member_name(&Tagged::flag), "flag");
+    EXPECT_EQ(member_name_at_offset<Tagged>(offsetof(Tagged, flag)), "flag");
+}
+
+TEST(NameOf, MemberNameSharedOffset) {
+    static_assert(offsetof(Marked, tag) == offsetof(Marked, value) && offsetof(Marked, mark) == offsetof(Marked, value));
+    EXPECT_EQ(member_name(&Marked::tag), "tag");
+    EXPECT_EQ(member_name(&Marked::mark), "mark");
+    EXPECT_EQ(member_name(&Marked::value), "value");
+    EXPECT_EQ(member_name_at_offset<Marked>(offsetof(Marked, value)), "value");
+    EXPECT_EQ(member_name_at_offset<Marked>(offsetof(Marked, value) + 3), "value");
+}
+#endif
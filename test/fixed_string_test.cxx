@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * fixed_string_test.cpp - Unit test for consteval nameof returning fixed_string
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+static_assert(fixed_string{"abc"}.size() == 3);
+static_assert(fixed_string{"abc"} == "abc");
+static_assert(fixed_string{"abc"} != "abd");
+
+#if NAMEOF_CONSTEVAL
+namespace {
+template <fixed_string Name>
+struct dispatcher {
+    static constexpr name_type name() { return Name; }
+};
+}
+
+static_assert(std::is_same_v<decltype(nameof<int>()), const fixed_string<3>&>);
+static_assert(std::is_same_v<decltype(dispatcher<nameof<NameSpace::Class>()>{}), dispatcher<fixed_string{"Class"}>>);
+static_assert(dispatcher<fully_qualified_nameof<&NameSpace::Class::member>()>::name() == "NameSpace::Class::member");
+
+TEST(NameOf, FixedStringIsStatic) {
+    const name_type first = nameof<NameSpace::Class>();
+    const name_type second = nameof<NameSpace::Class>();
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(first.data()[first.size()], '\0');
+    EXPECT_EQ(first.data(), static_nameof<NameSpace::Class>().data());
+}
+
+TEST(NameOf, FixedStringTemplateArgument) {
+    EXPECT_EQ(dispatcher<fully_qualified_nameof<test_enum::test_zero>()>::name(), "test_enum::test_zero");
+}
+#else
+TEST(NameOf, NameofIsView) {
+    EXPECT_TRUE((std::is_same_v<decltype(nameof<int>()), name_type>));
+}
+#endif
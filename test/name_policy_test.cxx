@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * name_policy_test.cpp - Unit test for nameof with name transformation policies
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+
+namespace company {
+namespace internal {
+struct Gadget {};
+template <typename T>
+struct Widget {
+    template <typename U>
+    struct Part {};
+    int member;
+};
+}
+struct Tool {};
+}
+
+namespace {
+using namespace meta;
+using namespace company::internal;
+
+#if __cpp_nontype_template_args >= 201911L
+using strip_company = strip_ns<"company">;
+using strip_company_internal = strip_ns<"company::internal">;
+#else
+inline constexpr char company_ns[] = "company";
+inline constexpr char company_internal_ns[] = "company::internal";
+using strip_company = strip_ns<company_ns>;
+using strip_company_internal = strip_ns<company_internal_ns>;
+#endif
+
+using WidgetOfGadget = Widget<Gadget>;
+using WidgetOfWidget = Widget<Widget<company::Tool>>;
+using PartOfWidget = Widget<Gadget>::Part<company::Tool>;
+}
+
+using namespace meta::detail;
+
+static_assert(find_group("A<B<C>, D>::E<F>").start == 1);
+static_assert(find_group("A<B<C>, D>::E<F>").finish == 9);
+static_assert(find_group("A<&B::operator<, C<D> >").finish == 22);
+static_assert(find_group("A<&B::operator->>").finish == 16);
+static_assert(find_group("A<auto (*)() -> int>").finish == 19);
+static_assert(parse_fully_qualified_name("ns::A<ns::B>") == "A");
+static_assert(parse_fully_qualified_name("ns::A<ns::B<ns::C> >::D<ns::E>") == "D");
+static_assert(parse_fully_qualified_name("(anonymous namespace)::A") == "A");
+static_assert(parse_fully_qualified_name("ns::A::operator<") == "operator<");
+
+#define TESTCASE(NAME, INPUT, EXPECTED, ...) \
+    TEST(NameOf, NAME) { EXPECT_EQ((nameof<INPUT, __VA_ARGS__>()), EXPECTED) << name_type{fully_qualified_nameof<INPUT>()}; }
+
+TESTCASE(PolicyNestedTemplateStem, WidgetOfWidget, "Widget<company::internal::Widget<company::Tool> >", unqualified)
+TESTCASE(PolicyStripNs,            WidgetOfGadget, "internal::Widget<internal::Gadget>", strip_company)
+TESTCASE(PolicyStripNestedNs,      WidgetOfGadget, "Widget<Gadget>", strip_company_internal)
+TESTCASE(PolicyStripNsKeepsOthers, PartOfWidget, "Widget<Gadget>::Part<company::Tool>", strip_company_internal)
+TESTCASE(PolicyShortArgs,          WidgetOfWidget, "company::internal::Widget<Widget<Tool> >", short_template_args)
+TESTCASE(PolicyShortArgsOfMember,  PartOfWidget, "company::internal::Widget<Gadget>::Part<Tool>", short_template_args)
+TESTCASE(PolicyNoArgs,             PartOfWidget, "company::internal::Widget::Part", no_template_args)
+TESTCASE(PolicyMaxLen,             WidgetOfGadget, "company::internal::Widget", max_len<25>)
+TESTCASE(PolicyMaxLenOfShort,      Gadget, "company::internal::Gadget", max_len<64>)
+TESTCASE(PolicyPipeline,           WidgetOfWidget, "Widget<Widget<", strip_company, short_template_args, unqualified, max_len<14>)
+TESTCASE(PolicyPipelineOrder,      WidgetOfGadget, "Widget", no_template_args, unqualified, max_len<6>, strip_company)
+TESTCASE(PolicyMember,             &WidgetOfGadget::member, "Widget<Gadget>::member", strip_company_internal)
+TESTCASE(PolicyEnumerator,         test_enum::test_zero, "test_zero", unqualified)
+
+TEST(NameOf, PolicyStaticStorage) {
+    const name_type first = nameof<WidgetOfGadget, short_template_args, max_len<64>>();
+    const name_type second = nameof<WidgetOfGadget, short_template_args, max_len<64>>();
+    EXPECT_EQ(first.data(), second.data());
+    EXPECT_EQ(first.data()[first.size()], '\0');
+}
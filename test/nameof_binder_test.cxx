@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_binder_test.cpp - Unit test for binding key/value strings to struct members
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_binder.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+enum class Mode { passive, active };
+
+struct Config {
+    std::string_view host;
+    unsigned short port;
+    int retries;
+    double timeout;
+    bool verbose;
+    Mode mode;
+    long long limit;
+};
+
+using ConfigBinder = binder<Config, &Config::host, &Config::port, &Config::retries, &Config::timeout,
+                            &Config::verbose, &Config::mode, &Config::limit>;
+}
+
+static_assert(ConfigBinder::count() == 7);
+static_assert(ConfigBinder::find("port") == 1);
+static_assert(ConfigBinder::find("limit") == 6);
+static_assert(ConfigBinder::find("Port") == ConfigBinder::count());
+
+#define TESTCASE(NAME, KEY, VALUE, STATUS, MEMBER, EXPECTED) TEST(NameOf, NAME) { \
+    Config config {}; \
+    EXPECT_EQ(ConfigBinder::bind(config, KEY, VALUE), bind_status::STATUS); \
+    EXPECT_EQ(config.MEMBER, EXPECTED); }
+
+TESTCASE(BinderHost,          "host", "example.com", ok, host, "example.com"sv)
+TESTCASE(BinderPort,          "port", "8080", ok, port, 8080)
+TESTCASE(BinderNegative,      "retries", "-3", ok, retries, -3)
+TESTCASE(BinderDouble,        "timeout", "2.5", ok, timeout, 2.5)
+TESTCASE(BinderBoolTrue,      "verbose", "true", ok, verbose, true)
+TESTCASE(BinderBoolOne,       "verbose", "1", ok, verbose, true)
+TESTCASE(BinderEnum,          "mode", "active", ok, mode, Mode::active)
+TESTCASE(BinderLongLong,      "limit", "9000000000", ok, limit, 9000000000LL)
+TESTCASE(BinderUnknownKey,    "ports", "8080", unknown_key, port, 0)
+TESTCASE(BinderEmptyKey,      "", "8080", unknown_key, port, 0)
+TESTCASE(BinderOutOfRange,    "port", "65536", out_of_range, port, 0)
+TESTCASE(BinderTrailingChars, "port", "80x", invalid_value, port, 0)
+TESTCASE(BinderEmptyValue,    "retries", "", invalid_value, retries, 0)
+TESTCASE(BinderBadBool,       "verbose", "yes", invalid_value, verbose, false)
+TESTCASE(BinderBadEnum,       "mode", "Active", invalid_value, mode, Mode::passive)
+
+TEST(NameOf, BinderFreeFunction) {
+    Config config {};
+    EXPECT_EQ((bind<&Config::port, &Config::retries>(config, "retries", "7")), bind_status::ok);
+    EXPECT_EQ((bind<&Config::port, &Config::retries>(config, "host", "localhost")), bind_status::unknown_key);
+    EXPECT_EQ(config.retries, 7);
+}
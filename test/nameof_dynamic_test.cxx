@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_dynamic_test.cpp - Unit test for dynamic_nameof
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_dynamic.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace dynamic_test {
+struct Shape {
+    virtual ~Shape() = default;
+};
+
+struct Circle : Shape {};
+struct Square : Shape {};
+struct Unregistered : Shape {};
+
+template <typename T>
+struct Polygon : Shape, dynamic_name<Polygon<T>> {};
+
+template <unsigned N>
+struct Many : Shape {};
+}
+
+NAMEOF_REGISTER_DYNAMIC(dynamic_test::Circle);
+NAMEOF_REGISTER_DYNAMIC(dynamic_test::Square);
+
+using namespace dynamic_test;
+
+TEST(NameOf, DynamicNameof) {
+    const std::unique_ptr<Shape> shapes[] = { std::make_unique<Circle>(), std::make_unique<Square>() };
+    EXPECT_EQ(dynamic_nameof(*shapes[0]), "dynamic_test::Circle");
+    EXPECT_EQ(dynamic_nameof(*shapes[1]), "dynamic_test::Square");
+    EXPECT_EQ(dynamic_nameof(*shapes[1]), fully_qualified_nameof<Square>());
+}
+
+TEST(NameOf, DynamicNameofUnregistered) {
+    const Unregistered unregistered {};
+    EXPECT_EQ(dynamic_nameof(static_cast<const Shape&>(unregistered)), "");
+}
+
+TEST(NameOf, DynamicNameofMixin) {
+    const Polygon<int> polygon {};
+    const Shape& shape = polygon;
+    EXPECT_EQ(dynamic_nameof(shape), "dynamic_test::Polygon<int>");
+}
+
+namespace {
+template <unsigned ... I>
+void register_many(std::integer_sequence<unsigned, I...>) {
+    (register_dynamic_name<Many<I>>(), ...);
+}
+
+template <unsigned ... I>
+bool lookup_many(std::integer_sequence<unsigned, I...>) {
+    return ((dynamic_nameof(typeid(Many<I>)).empty() || dynamic_nameof(typeid(Many<I>)) == fully_qualified_nameof<Many<I>>()) && ...);
+}
+}
+
+TEST(NameOf, DynamicNameofConcurrent) {
+    constexpr auto indices = std::make_integer_sequence<unsigned, 64>{};
+    std::vector<std::thread> readers;
+    std::atomic<bool> consistent { true };
+    for(int i = 0; i < 4; ++i)
+        readers.emplace_back([&] { for(int j = 0; j < 100; ++j) if (!lookup_many(indices)) consistent = false; });
+    register_many(indices);
+    for(auto& reader : readers)
+        reader.join();
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(dynamic_nameof(typeid(Many<63>)), "dynamic_test::Many<63>");
+}
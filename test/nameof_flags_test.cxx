@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_flags_test.cpp - Unit test for flags_to_chars and flags_from_string
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_flags.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+enum class Permission : unsigned char { none = 0, read = 1, write = 2, execute = 4, all = 7 };
+enum class Feature : int { alpha = 1 << 0, beta = 1 << 5, gamma = 1 << 30, sign = -2147483647 - 1 };
+enum Option { option_none = 0, option_verbose = 1, option_quiet = 2, option_color = 8 };
+enum Fixed : unsigned short { fixed_low = 1, fixed_high = 1 << 15 };
+
+constexpr Permission operator|(Permission lhs, Permission rhs) {
+    return static_cast<Permission>(static_cast<unsigned>(lhs) | static_cast<unsigned>(rhs));
+}
+
+template <typename E, char Separator = '|'>
+std::string to_string(E value) {
+    char buffer[flags_max_size<E>()];
+    const auto result = flags_to_chars<E, Separator>(value, buffer, sizeof(buffer));
+    EXPECT_EQ(result.ec, std::errc{});
+    return { buffer, result.ptr };
+}
+}
+
+template <>
+struct meta::enum_range<Option> {
+    static constexpr int min = 0;
+    static constexpr int max = 15;
+};
+
+static_assert(detail::has_fixed_underlying_type<Permission>::value);
+static_assert(detail::has_fixed_underlying_type<Fixed>::value);
+static_assert(! detail::has_fixed_underlying_type<Option>::value);
+static_assert(detail::flag_table<Option>::bits == 4);
+static_assert(detail::flag_table<Option>::count() == 3);
+static_assert(detail::flag_table<Fixed>::bits == 16);
+static_assert(detail::flag_table<Fixed>::count() == 2);
+static_assert(detail::flag_table<Permission>::count() == 3);
+static_assert(detail::flag_table<Feature>::count() == 4);
+static_assert(flags_max_size<Permission>() == sizeof("read|write|execute|") - 1 + 3);
+
+TEST(NameOf, FlagsToChars) {
+    EXPECT_EQ(to_string(Permission::read), "read");
+    EXPECT_EQ(to_string(Permission::read | Permission::execute), "read|execute");
+    EXPECT_EQ(to_string(Permission::all), "read|write|execute");
+    EXPECT_EQ(to_string(Permission::none), "");
+    EXPECT_EQ(to_string(Permission::write | static_cast<Permission>(64)), "write|64");
+    EXPECT_EQ(to_string(static_cast<Permission>(200)), "200");
+    EXPECT_EQ((to_string<Feature, ','>(static_cast<Feature>(static_cast<int>(Feature::beta) | static_cast<int>(Feature::sign)))), "beta,sign");
+}
+
+TEST(NameOf, FlagsToCharsTooLarge) {
+    char buffer[8];
+    EXPECT_EQ(flags_to_chars(Permission::all, buffer, sizeof(buffer)).ec, std::errc::value_too_large);
+    EXPECT_EQ(flags_to_chars(Permission::write | static_cast<Permission>(64), buffer, 6).ec, std::errc::value_too_large);
+    EXPECT_EQ(flags_to_chars(Permission::write, buffer, 5).ec, std::errc{});
+}
+
+TEST(NameOf, FlagsFromString) {
+    EXPECT_EQ(flags_from_string<Permission>("read|execute"), Permission::read | Permission::execute);
+    EXPECT_EQ(flags_from_string<Permission>("write"), Permission::write);
+    EXPECT_EQ(flags_from_string<Permission>(""), Permission::none);
+    EXPECT_EQ(flags_from_string<Permission>("write|64"), Permission::write | static_cast<Permission>(64));
+    EXPECT_EQ((flags_from_string<Feature, ','>("gamma,alpha")), static_cast<Feature>((1 << 30) | 1));
+    EXPECT_EQ(flags_from_string<Permission>("read|"), std::nullopt);
+    EXPECT_EQ(flags_from_string<Permission>("read||write"), std::nullopt);
+    EXPECT_EQ(flags_from_string<Permission>("Read"), std::nullopt);
+    EXPECT_EQ(flags_from_string<Permission>("all"), std::nullopt);
+    EXPECT_EQ(flags_from_string<Permission>("1000"), std::nullopt);
+}
+
+TEST(NameOf, FlagsUnscoped) {
+    EXPECT_EQ(to_string(static_cast<Option>(option_verbose | option_color)), "option_verbose|option_color");
+    EXPECT_EQ(to_string(static_cast<Option>(option_quiet | 4)), "option_quiet|4");
+    EXPECT_EQ(flags_from_string<Option>("option_quiet|option_color"), static_cast<Option>(option_quiet | option_color));
+    EXPECT_EQ(flags_from_string<Option>("option_quiet|4"), static_cast<Option>(6));
+    EXPECT_EQ(flags_from_string<Option>("16"), std::nullopt);
+    EXPECT_EQ(to_string(static_cast<Fixed>(fixed_low | fixed_high)), "fixed_low|fixed_high");
+}
+
+TEST(NameOf, FlagsRoundTrip) {
+    for(unsigned i = 0; i < 256; ++i) {
+        const auto value = static_cast<Permission>(i);
+        EXPECT_EQ(flags_from_string<Permission>(to_string(value)), value);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_format_test.cpp - Unit test for enum formatters
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#if __has_include(<fmt/format.h>)
+#define FMT_HEADER_ONLY
+#include <fmt/format.h>
+#endif
+#include <meta/nameof_format.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace {
+enum class Level : unsigned char { debug, info, warning = 5, error };
+enum class Hidden { on, off };
+}
+
+template <>
+struct meta::enable_enum_format<Level> {
+    static constexpr bool value = true;
+};
+
+template <>
+struct meta::enable_enum_format<test_enum> {
+    static constexpr bool value = true;
+};
+
+TEST(NameOf, EnumFormatSpec) {
+    std::string out;
+    enum_format_spec spec {};
+    const auto format = "qd>8}"sv;
+    EXPECT_EQ(spec.parse(format.begin(), format.end()), format.begin() + 2);
+    EXPECT_TRUE(spec.qualified);
+    spec.format(static_cast<Level>(200), std::back_inserter(out));
+    EXPECT_EQ(out, "200");
+    out.clear();
+    spec.format(Level::info, std::back_inserter(out));
+    EXPECT_EQ(out, fully_qualified_nameof<Level::info>());
+}
+
+#if defined(FMT_VERSION)
+TEST(NameOf, FmtEnum) {
+    EXPECT_EQ(fmt::format("{}", Level::info), "info");
+    EXPECT_EQ(fmt::format("{:q}", Level::warning), fully_qualified_nameof<Level::warning>());
+    EXPECT_EQ(fmt::format("{}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(fmt::format("{:q}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(fmt::format("{:d}", Level::error), "error");
+    EXPECT_EQ(fmt::format("{:d}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(fmt::format("{:qd}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(fmt::format("{:q}", test_enum::test_zero), "test_enum::test_zero");
+    EXPECT_EQ(fmt::format("{:>6}", Level::info), "  info");
+    EXPECT_EQ(fmt::format("{:*<7}", Level::error), "error**");
+    EXPECT_EQ(fmt::format("{:q^24}", test_enum::test_zero), "  test_enum::test_zero  ");
+    EXPECT_EQ(fmt::format("{:d>3}", static_cast<Level>(4)), "  4");
+    EXPECT_EQ(fmt::format("{:>{}}", Level::info, 5), " info");
+    EXPECT_THROW(static_cast<void>(fmt::format(fmt::runtime("{:x}"), Level::info)), fmt::format_error);
+    static_assert(! fmt::is_formattable<Hidden>::value);
+}
+#endif
+
+#if defined(__cpp_lib_format)
+TEST(NameOf, StdFormatEnum) {
+    EXPECT_EQ(std::format("{}", Level::info), "info");
+    EXPECT_EQ(std::format("{}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(std::format("{:d}", Level::error), "error");
+    EXPECT_EQ(std::format("{:d}", static_cast<Level>(3)), "3");
+    EXPECT_EQ(std::format("{:q}", test_enum::test_zero), "test_enum::test_zero");
+    EXPECT_EQ(std::format("{:>6}", Level::info), "  info");
+    EXPECT_EQ(std::format("{:q^24}", test_enum::test_zero), "  test_enum::test_zero  ");
+    const auto level = Level::info;
+    EXPECT_THROW(static_cast<void>(std::vformat("{:x}", std::make_format_args(level))), std::format_error);
+    static_assert(! std::is_default_constructible_v<std::formatter<Hidden, char>>);
+}
+#endif
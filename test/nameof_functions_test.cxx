@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_functions_test.cpp - Unit test for name_of_address
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_functions.h>
+#include <csignal>
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace functions_test {
+static int add(int a, int b) { return a + b; }
+static int subtract(int a, int b) { return a - b; }
+static int multiply(int a, int b) { return a * b; }
+static int unregistered(int a) { return a; }
+
+struct Handler {
+    virtual ~Handler() = default;
+    void on_data() {}
+    virtual void on_error() {}
+    static void on_timer() {}
+};
+
+template <typename T>
+T identity(T value) { return value; }
+}
+
+NAMEOF_REGISTER_FUNCTION(&functions_test::add);
+NAMEOF_REGISTER_FUNCTION(&functions_test::subtract);
+NAMEOF_REGISTER_FUNCTION(&functions_test::multiply);
+NAMEOF_REGISTER_FUNCTION(&functions_test::Handler::on_data);
+NAMEOF_REGISTER_FUNCTION(&functions_test::Handler::on_error);
+NAMEOF_REGISTER_FUNCTION(&functions_test::Handler::on_timer);
+NAMEOF_REGISTER_FUNCTION(&functions_test::identity<long>);
+NAMEOF_REGISTER_FUNCTION(&functions_test::add);
+
+using namespace functions_test;
+
+namespace {
+template <typename F>
+const void* address(F function) {
+    return reinterpret_cast<const void*>(function);
+}
+
+std::atomic<bool> signal_lookup_passed { false };
+
+void on_signal(int) {
+    signal_lookup_passed = name_of_address(address(&subtract)) == "functions_test::subtract";
+}
+}
+
+#if defined(__ELF__) || defined(_MSC_VER)
+TEST(NameOf, NameOfAddress) {
+    EXPECT_EQ(name_of_address(address(&add)), "functions_test::add");
+    EXPECT_EQ(name_of_address(address(&subtract)), "functions_test::subtract");
+    EXPECT_EQ(name_of_address(address(&multiply)), "functions_test::multiply");
+    EXPECT_EQ(name_of_address(address(&Handler::on_timer)), "functions_test::Handler::on_timer");
+    EXPECT_EQ(name_of_address(address(&identity<long>)), "functions_test::identity<long int>");
+    EXPECT_EQ(name_of_address(address(&unregistered)), "");
+    EXPECT_EQ(name_of_address(nullptr), "");
+    EXPECT_EQ(registered_functions_count(), 8);
+}
+
+TEST(NameOf, NameOfMemberFunctionAddress) {
+    EXPECT_EQ(name_of_address(detail::function_address<&Handler::on_data>()), "functions_test::Handler::on_data");
+    EXPECT_EQ(detail::function_address<&Handler::on_error>(), nullptr);
+}
+
+TEST(NameOf, NameOfCodeAddress) {
+    const auto code = static_cast<const char*>(address(&add)) + 1;
+    EXPECT_EQ(name_of_code_address(address(&add)), "functions_test::add");
+    EXPECT_EQ(name_of_address(code), "");
+    EXPECT_EQ(name_of_code_address(address(&unregistered)), "");
+    EXPECT_EQ(name_of_code_address(static_cast<const char*>(address(&unregistered)) + 1), "");
+}
+
+#if defined(__linux__)
+TEST(NameOf, NameOfCodeAddressPastEnd) {
+    ASSERT_TRUE(load_function_sizes());
+    EXPECT_EQ(name_of_code_address(static_cast<const char*>(address(&add)) + 1), "functions_test::add");
+    const auto entry = detail::find_function(address(&multiply));
+    ASSERT_NE(entry, nullptr);
+    ASSERT_NE(entry->size, 0);
+    const auto code = static_cast<const char*>(address(&multiply));
+    EXPECT_EQ(name_of_code_address(code + entry->size - 1), "functions_test::multiply");
+    EXPECT_NE(name_of_code_address(code + entry->size), "functions_test::multiply");
+}
+#endif
+
+TEST(NameOf, NameOfAddressInSignalHandler) {
+    const auto previous = std::signal(SIGUSR1, on_signal);
+    std::raise(SIGUSR1);
+    std::signal(SIGUSR1, previous);
+    EXPECT_TRUE(signal_lookup_passed);
+}
+#endif
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_intern_test.cpp - Unit test for name_id_of, name_dictionary and name_decoder
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_intern.h>
+#include <string>
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+
+namespace intern_test {
+struct Order {};
+struct Cancel {};
+enum class Side { buy, sell };
+}
+
+using namespace intern_test;
+
+namespace {
+using Dictionary = name_dictionary<Order, Cancel, Side>;
+
+constexpr std::array<detail::name_entry, 5> unsorted_entries {{
+    { 0x01000002, "a" }, { 0x00000002, "b" }, { 0xFF000000, "c" }, { 0x00010000, "d" }, { 0x00000001, "e" } }};
+constexpr auto sorted_entries = detail::sort_by_id(unsorted_entries);
+constexpr std::array<detail::name_entry, 1> long_entry {{ { 1, name_type{ "long", detail::name_image_max_size + 1 } } }};
+}
+
+static_assert(name_id_of<Order>() != 0);
+static_assert(name_id_of<Order>() != name_id_of<Cancel>());
+static_assert(enum_name_id(Side::sell) == name_id_of<Side::sell>());
+static_assert(enum_name_id(static_cast<Side>(7)) == 0);
+static_assert(Dictionary::entries.size() == 5);
+static_assert(Dictionary::find(name_id_of<Side::buy>()) == "intern_test::Side::buy");
+static_assert(Dictionary::find(name_id_of<int>()).empty());
+static_assert(sorted_entries[0].name == "e" && sorted_entries[1].name == "b" && sorted_entries[2].name == "d");
+static_assert(sorted_entries[3].name == "a" && sorted_entries[4].name == "c");
+static_assert(detail::names_fit_image(Dictionary::entries));
+static_assert(! detail::names_fit_image(long_entry));
+
+TEST(NameOf, NameIdStable) {
+    // FNV-1a of the canonical name, folded to 32 bits, does not depend on compiler
+    EXPECT_EQ(name_id_of<Order>(), detail::fold_name_id(detail::fnv1a("intern_test::Order")));
+    EXPECT_EQ(name_id_of<std::string_view>(), detail::fold_name_id(detail::fnv1a("std::basic_string_view<char>")));
+}
+
+TEST(NameOf, NameDictionaryImage) {
+    const name_type image { Dictionary::image.data(), Dictionary::image.size() };
+    EXPECT_EQ(image.substr(0, 4), "NMID");
+    EXPECT_EQ(image[4], 5);
+    EXPECT_NE(image.find("intern_test::Cancel"), name_type::npos);
+    EXPECT_EQ(image.size(), 8 + 5 * 6 + "intern_test::Order"sv.size() + "intern_test::Cancel"sv.size()
+        + "intern_test::Side"sv.size() + "intern_test::Side::buy"sv.size() + "intern_test::Side::sell"sv.size());
+}
+
+TEST(NameOf, NameDecoder) {
+    const std::string file { Dictionary::image.data(), Dictionary::image.size() };
+    name_decoder decoder {};
+    ASSERT_TRUE(decoder.load(file));
+    EXPECT_EQ(decoder.size(), 5);
+    EXPECT_EQ(decoder(name_id_of<Order>()), "intern_test::Order");
+    EXPECT_EQ(decoder(enum_name_id(Side::sell)), "intern_test::Side::sell");
+    EXPECT_EQ(decoder(0), "");
+}
+
+TEST(NameOf, NameDecoderMalformed) {
+    name_decoder decoder {};
+    EXPECT_FALSE(decoder.load("NMID"));
+    EXPECT_FALSE(decoder.load("XMID\0\0\0\0"sv));
+    const std::string truncated { Dictionary::image.data(), Dictionary::image.size() - 1 };
+    EXPECT_FALSE(decoder.load(truncated));
+    EXPECT_EQ(decoder.size(), 0);
+    const std::string file { Dictionary::image.data(), Dictionary::image.size() };
+    ASSERT_TRUE(decoder.load(file));
+    EXPECT_FALSE(decoder.load(truncated));
+    EXPECT_EQ(decoder.size(), 0);
+    EXPECT_EQ(decoder(name_id_of<Order>()), "");
+    EXPECT_TRUE(decoder.load("NMID\0\0\0\0"sv));
+    EXPECT_EQ(decoder.size(), 0);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_registry_test.cpp - Unit test for the registry of exported type names
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof_registry.h>
+#include <set>
+#include <string>
+#include <vector>
+#include "nameof_registry_test.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+using namespace registry_test;
+
+NAMEOF_EXPORT(registry_test::Order);
+NAMEOF_EXPORT(registry_test::Order);
+NAMEOF_EXPORT(registry_test::Cancel);
+NAMEOF_EXPORT(registry_test::Side);
+
+#if defined(__ELF__) || defined(_MSC_VER)
+TEST(NameOf, RegistryCount) {
+    EXPECT_EQ(detail::names_state.load(), detail::section_state::unsorted);
+    EXPECT_EQ(exported_names_count(), exported_by_other_unit() + 1);
+    EXPECT_EQ(detail::names_state.load(), detail::section_state::sorted);
+}
+
+TEST(NameOf, RegistryUnique) {
+    std::vector<std::string> names;
+    for_each_exported_name([&names](const name_record& record) { names.emplace_back(record.view()); });
+    EXPECT_EQ(names.size(), std::set<std::string>(names.begin(), names.end()).size());
+    EXPECT_EQ(std::set<std::string>(names.begin(), names.end()), (std::set<std::string>{
+        "registry_test::Order", "registry_test::Cancel", "registry_test::Replace", "registry_test::Side" }));
+}
+
+TEST(NameOf, RegistryHashes) {
+    for_each_exported_name([](const name_record& record) {
+        EXPECT_EQ(record.hash, detail::fnv1a(record.view())) << record.view();
+        EXPECT_EQ(record.name[record.size], '\0');
+    });
+}
+
+TEST(NameOf, RegistryFind) {
+    const auto record = find_exported_name(type_hash<Replace>());
+    ASSERT_NE(record, nullptr);
+    EXPECT_EQ(record->view(), canonical_nameof<Replace>());
+    EXPECT_EQ(find_exported_name(type_hash<int>()), nullptr);
+}
+#endif
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_registry_test.h - types exported to the name registry from two translation units
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace registry_test {
+struct Order {};
+struct Cancel {};
+struct Replace {};
+enum class Side { buy, sell };
+
+/// Returns number of types exported by nameof_registry_unit.cxx, some of them are exported by the test as well
+std::size_t exported_by_other_unit();
+}
@@ -0,0 +1,21 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * nameof_registry_unit.cpp - types exported to the name registry from a separate translation unit
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <meta/nameof_registry.h>
+#include "nameof_registry_test.h"
+
+NAMEOF_EXPORT(registry_test::Order);
+NAMEOF_EXPORT(registry_test::Replace);
+NAMEOF_EXPORT(registry_test::Side);
+
+namespace registry_test {
+std::size_t exported_by_other_unit() {
+    return 3;
+}
+}
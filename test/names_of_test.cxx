@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * names_of_test.cpp - Unit test for names_of and canonical_names_of
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+using namespace NameSpace;
+
+namespace {
+using IntMap = std::map<int, int>;
+using FunctionPtr = int (*)(int, char);
+using PackTypes = type_list<Class, Class::Inner, Class::Template<wchar_t>, test_enum, IntMap, FunctionPtr, std::string_view>;
+struct Anonymous {};
+template <typename T, typename U = int>
+struct Defaulted {};
+}
+
+static_assert(names_of<>().empty());
+static_assert(names_of<Class>()[0] == "NameSpace::Class");
+static_assert(names_of<PackTypes>().size() == PackTypes::size);
+
+TEST(NameOf, NamesOf) {
+    const auto& names = names_of<Class, Class::Inner, Class::Template<wchar_t>, test_enum>();
+    EXPECT_EQ(names, (std::array{ "NameSpace::Class"sv, "NameSpace::Class::Inner"sv, "NameSpace::Class::Template<wchar_t>"sv, "test_enum"sv }));
+}
+
+TEST(NameOf, NamesOfTypeList) {
+    const auto& names = names_of<PackTypes>();
+    EXPECT_EQ(names[0], "NameSpace::Class");
+    EXPECT_EQ(names[3], "test_enum");
+    EXPECT_EQ(names[5], (AnyOf{ "int (*)(int, char)", "int (*)(int,char)", "int (__cdecl *)(int,char)" }));
+}
+
+TEST(NameOf, NamesOfSameAsPerType) {
+    const auto& names = names_of<std::string, Anonymous, IntMap, Defaulted<char>, std::vector<Anonymous>>();
+    EXPECT_EQ(names[0], name_type{fully_qualified_nameof<std::string>()});
+    EXPECT_EQ(names[1], name_type{fully_qualified_nameof<Anonymous>()});
+    EXPECT_EQ(names[2], name_type{fully_qualified_nameof<IntMap>()});
+    EXPECT_EQ(names[3], name_type{fully_qualified_nameof<Defaulted<char>>()});
+    EXPECT_EQ(names[4], name_type{fully_qualified_nameof<std::vector<Anonymous>>()});
+}
+
+TEST(NameOf, NamesOfSameAsPerTypeCompound) {
+    const auto& names = names_of<int[3], const char*, int&, void, Defaulted<Defaulted<char>>, FunctionPtr>();
+    EXPECT_EQ(names[0], name_type{fully_qualified_nameof<int[3]>()});
+    EXPECT_EQ(names[1], name_type{fully_qualified_nameof<const char*>()});
+    EXPECT_EQ(names[2], name_type{fully_qualified_nameof<int&>()});
+    EXPECT_EQ(names[3], name_type{fully_qualified_nameof<void>()});
+    EXPECT_EQ(names[4], name_type{fully_qualified_nameof<Defaulted<Defaulted<char>>>()});
+    EXPECT_EQ(names[5], name_type{fully_qualified_nameof<FunctionPtr>()});
+}
+
+TEST(NameOf, NamesOfContiguous) {
+    const auto& names = names_of<PackTypes>();
+    for(std::size_t i = 1; i < names.size(); ++i)
+        EXPECT_EQ(names[i - 1].data() + names[i - 1].size() + 1, names[i].data());
+    EXPECT_EQ(names.back().data()[names.back().size()], '\0');
+}
+
+TEST(NameOf, CanonicalNamesOf) {
+    const auto& names = canonical_names_of<PackTypes>();
+    EXPECT_EQ(names[0], canonical_nameof<Class>());
+    EXPECT_EQ(names[1], canonical_nameof<Class::Inner>());
+    EXPECT_EQ(names[2], canonical_nameof<Class::Template<wchar_t>>());
+    EXPECT_EQ(names[3], canonical_nameof<test_enum>());
+    EXPECT_EQ(names[4], "std::map<int,int>");
+    EXPECT_EQ(names[5], "int(*)(int,char)");
+    EXPECT_EQ(names[6], canonical_nameof<std::string_view>());
+}
@@ -11,6 +11,7 @@
 #include <meta/nameof.h>
 #include <string_view>
 #include <array>
+#include "test_inputs.h"
 
 namespace {
 using namespace testing;
@@ -19,22 +20,25 @@ using namespace std::literals;
 
 struct TestItem {
     std::string_view expected;
+    std::string_view canonical;
     std::string_view input;
 };
 
-constexpr std::array<TestItem, 12> test_sigs = {
-    TestItem{ "test_enum::test_zero"sv,                       "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = test_enum::test_zero]"sv},
-    TestItem{ "variable"sv,                                   "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = (& variable)]"sv},
-    TestItem{ "1"sv,                                          "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = 1]"sv},
-    TestItem{ "function"sv,                                   "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = function]"sv},
-    TestItem{ "func"sv,                                       "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = func]"sv},
-    TestItem{ "constant"sv,                                   "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = (& constant)]"sv},
-    TestItem{ "std::basic_string_view<char>"sv,               "int test(std::initializer_list<std::basic_string_view<char> >) [with T = std::basic_string_view<char>]"sv},
-    TestItem{ "TestSpace::Test"sv,                            "int test(std::initializer_list<std::basic_string_view<char> >) [with T = TestSpace::Test]"sv},
-    TestItem{ "TestSpace::Test::member"sv,                    "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::member]"sv},
-    TestItem{ "TestSpace::Test::Inner::member"sv,             "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::Inner::member]"sv},
-    TestItem{ "TestSpace::Test::Template<wchar_t>"sv,         "int test(std::initializer_list<std::basic_string_view<char> >) [with T = TestSpace::Test::Template<wchar_t>]"sv},
-    TestItem{ "TestSpace::Test::Template<wchar_t>::method"sv, "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::Template<wchar_t>::method]"sv},
+constexpr std::array<TestItem, 14> test_sigs = {
+    TestItem{ "test_enum::test_zero"sv,                       "test_enum::test_zero"sv,                     "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = test_enum::test_zero]"sv},
+    TestItem{ "variable"sv,                                   "variable"sv,                                 "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = (& variable)]"sv},
+    TestItem{ "1"sv,                                          "1"sv,                                        "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = 1]"sv},
+    TestItem{ "function"sv,                                   "function"sv,                                 "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = function]"sv},
+    TestItem{ "func"sv,                                       "func"sv,                                     "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = func]"sv},
+    TestItem{ "constant"sv,                                   "constant"sv,                                 "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = (& constant)]"sv},
+    TestItem{ "std::basic_string_view<char>"sv,               "std::basic_string_view<char>"sv,             "int test(std::initializer_list<std::basic_string_view<char> >) [with T = std::basic_string_view<char>]"sv},
+    TestItem{ "TestSpace::Test"sv,                            "TestSpace::Test"sv,                          "int test(std::initializer_list<std::basic_string_view<char> >) [with T = TestSpace::Test]"sv},
+    TestItem{ "TestSpace::Test::member"sv,                    "TestSpace::Test::member"sv,                  "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::member]"sv},
+    TestItem{ "TestSpace::Test::Inner::member"sv,             "TestSpace::Test::Inner::member"sv,           "int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::Inner::member]"sv},
+    TestItem{ "TestSpace::Test::Template<wchar_t>"sv,         "TestSpace::Test::Template<wchar_t>"sv,       "int test(std::initializer_list<std::basic_string_view<char> >) [with T = TestSpace::Test::Template<wchar_t>]"sv},
+    TestItem{ "TestSpace::Test::Template<wchar_t>::method"sv, "TestSpace::Test::Template<wchar_t>::method"sv,"int test(std::initializer_list<std::basic_string_view<char> >) [with auto V = &TestSpace::Test::Template<wchar_t>::method]"sv},
+    TestItem{ "int (*)(int, char)"sv,                         "int(*)(int,char)"sv,                         "int test(std::initializer_list<std::basic_string_view<char> >) [with T = int (*)(int, char)]"sv},
+    TestItem{ "int [3]"sv,                                    "int[3]"sv,                                   "int test(std::initializer_list<std::basic_string_view<char> >) [with T = int [3]]"sv},
 };
 }
 
@@ -43,6 +47,7 @@ TEST(NameOf, PrettyFunction) {
         const auto actual = parse_pretty_function(i.input);
         RecordProperty("Input"s, std::string{i.input});
         EXPECT_EQ(actual, i.expected);
+        EXPECT_EQ(canonical(actual), i.canonical);
     }
 }
 
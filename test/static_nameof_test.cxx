@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * static_nameof_test.cpp - Unit test for static_nameof and static_fully_qualified_nameof
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+using namespace NameSpace;
+
+#define TESTCASE(NAME, INPUT) TEST(NameOf, NAME) { \
+    EXPECT_EQ(static_nameof<INPUT>(), nameof<INPUT>()); \
+    EXPECT_EQ(static_fully_qualified_nameof<INPUT>(), fully_qualified_nameof<INPUT>()); \
+    EXPECT_EQ(static_nameof<INPUT>().data()[static_nameof<INPUT>().size()], '\0'); \
+    EXPECT_EQ(static_fully_qualified_nameof<INPUT>().data()[static_fully_qualified_nameof<INPUT>().size()], '\0'); }
+
+TESTCASE(StaticEnum,             test_enum::test_zero)
+TESTCASE(StaticVariable,         &variable)
+TESTCASE(StaticConstant,         constant)
+TESTCASE(StaticFunctionPtr,      &function)
+TESTCASE(StaticFancy,            &fancy)
+TESTCASE(StaticStringView,       std::string_view)
+TESTCASE(StaticClassName,        Class)
+TESTCASE(StaticMethod,           &Class::method)
+TESTCASE(StaticMember,           &Class::member)
+TESTCASE(StaticInnerClass,       Class::Inner)
+TESTCASE(StaticTemplate,         Class::Template<wchar_t>)
+TESTCASE(StaticTemplateFunction, &Class::Template<wchar_t>::function<std::string>)
+
+TEST(NameOf, StaticIsSameStorage) {
+    EXPECT_EQ(static_nameof<Class>().data(), static_nameof<Class>().data());
+#if NAMEOF_CONSTEVAL
+    EXPECT_EQ(static_nameof<Class>().data(), nameof<Class>().data());
+#else
+    EXPECT_NE(static_nameof<Class>().data(), nameof<Class>().data());
+#endif
+}
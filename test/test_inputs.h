@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <vector>
+#include <meta/nameof.h>
 
 inline int variable {};
 constexpr long constant = 1L;
@@ -45,6 +46,12 @@ enum class test_enum {
 static constexpr const long*(*func())() { return function; }
 decltype(&func) fancy(decltype(&function), decltype(&NameSpace::Class::Template<char>::methodptr));
 
+inline std::string canonical(std::string_view name) {
+    std::string result(meta::detail::canonicalize(name, nullptr), '\0');
+    meta::detail::canonicalize(name, result.data());
+    return result;
+}
+
 using AnyOf = std::vector<std::string_view>;
 namespace testing::internal {
 template <>
@@ -68,3 +75,16 @@ inline auto& operator<<(Stream& stream, const AnyOf& list) {
     return stream;
 }
 }
+
+namespace meta { // found by argument dependent lookup
+template <std::size_t N>
+inline testing::AssertionResult CmpHelperEQ(const char* lhs_expression, const char* rhs_expression,
+                                            const fixed_string<N>& lhs, const AnyOf& rhs) {
+    return testing::internal::CmpHelperEQ<std::string_view, AnyOf>(lhs_expression, rhs_expression, lhs.view(), rhs);
+}
+
+template <std::size_t N>
+void PrintTo(const fixed_string<N>& name, std::ostream* stream) {
+    *stream << name.view();
+}
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * type_hash_test.cpp - Unit test for type_hash and type_index_of
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <gtest/gtest.h>
+#include <meta/nameof.h>
+#include "test_inputs.h"
+#include "type_hash_test.h"
+
+using namespace testing;
+using namespace std::literals;
+using namespace meta;
+using namespace NameSpace;
+
+using TestTypes = type_list<Class, Class::Inner, Class::Template<char>, Class::Template<wchar_t>, std::string_view, test_enum>;
+
+static_assert(unique_type_hashes<TestTypes>());
+static_assert(! unique_type_hashes<type_list<Class, Class>>());
+static_assert(type_index_of<Class, TestTypes> == 0);
+static_assert(type_index_of<test_enum, TestTypes> == 5);
+static_assert(type_hash<Class>() == detail::fnv1a("NameSpace::Class"));
+
+#define TESTCASE(NAME, INPUT) TEST(NameOf, NAME) { \
+    EXPECT_EQ(type_hash<INPUT>(), detail::fnv1a(canonical_nameof<INPUT>())) << canonical_nameof<INPUT>(); }
+
+TESTCASE(TypeHashClass,       Class)
+TESTCASE(TypeHashInner,       Class::Inner)
+TESTCASE(TypeHashTemplate,    Class::Template<wchar_t>)
+TESTCASE(TypeHashStringView,  std::string_view)
+TESTCASE(TypeHashEnum,        test_enum)
+
+TEST(NameOf, TypeHashAcrossUnits) {
+    const auto hashes = type_hash_test::hashes_from_other_unit();
+    EXPECT_EQ(hashes[0], type_hash<Class>());
+    EXPECT_EQ(hashes[1], type_hash<Class::Template<wchar_t>>());
+    EXPECT_EQ(hashes[2], type_hash<std::string_view>());
+}
+
+TEST(NameOf, TypeIndexOf) {
+    std::array<int, TestTypes::size> registry {};
+    registry[type_index_of<Class::Inner, TestTypes>] = 1;
+    registry[type_index_of<std::string_view, TestTypes>] = 4;
+    EXPECT_EQ(registry[1], 1);
+    EXPECT_EQ(registry[4], 4);
+}
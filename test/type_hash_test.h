@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * type_hash_test.h - type hashes computed in a separate translation unit
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace type_hash_test {
+/// Returns type_hash of NameSpace::Class, NameSpace::Class::Template<wchar_t> and std::string_view
+std::array<std::uint64_t, 3> hashes_from_other_unit();
+}
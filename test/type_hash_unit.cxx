@@ -0,0 +1,23 @@
+/*
+ * Copyright (C) 2024 Eugene Hutorny <eugene@hutorny.in.ua>
+ *
+ * type_hash_unit.cpp - type hashes computed in a separate translation unit
+ *
+ * Licensed under MIT License, see full text in LICENSE
+ * or visit page https://opensource.org/license/mit/
+ */
+
+#include <meta/nameof.h>
+#include "test_inputs.h"
+#include "type_hash_test.h"
+
+namespace type_hash_test {
+std::array<std::uint64_t, 3> hashes_from_other_unit() {
+    using namespace NameSpace;
+    return {
+        meta::type_hash<Class>(),
+        meta::type_hash<Class::Template<wchar_t>>(),
+        meta::type_hash<std::string_view>(),
+    };
+}
+}